@@ -38,7 +38,9 @@ EEMEM uint8_t Eeprom_VALID	=  EEMEM_WRITE_VALUE;
 //-------------------------------------------------------------------------------------------
 // Load EEPROM into memory
 void EEPROM_LOAD_VAL_CONFIG() {
-
+	
+	uint8_t i;
+	
 	EEMEM_Written = EEPROM_READ_UINT8(&Eeprom_VALID);
 	if (EEMEM_Written == EEMEM_WRITE_VALUE) {		// load eeprom data
 		EEPROM_READ_STRING(&Sample_Name[0], &EROM_Sample_Name[0], NAME_LENGTH);
@@ -100,11 +102,55 @@ void EEPROM_LOAD_VAL_CONFIG() {
 		LOAD_MPPT_Tolerance_CND = EEPROM_READ_FLOAT(&EROM_LOAD_MPPT_Tolerance_CND);
 		LOAD_MPPT_Tolerance_CND = LOAD_MPPT_Tolerance_CND * LOAD_MPPT_Tolerance_CND;
 		LOAD_MPPT_Timer_Update_Delay = EEPROM_READ_UINT16(&EROM_LOAD_MPPT_Timer_Update_Delay);
+		LOAD_MPPT_Mini_IV_Interval = EEPROM_READ_UINT16(&EROM_LOAD_MPPT_Mini_IV_Interval);
+		LOAD_IncC_Cond_Band = EEPROM_READ_FLOAT(&EROM_LOAD_IncC_Cond_Band);
+		LOAD_IncC_Volt_Noise_CND = EEPROM_READ_FLOAT(&EROM_LOAD_IncC_Volt_Noise_CND);
+		LOAD_IncC_Curr_Noise_CND = EEPROM_READ_FLOAT(&EROM_LOAD_IncC_Curr_Noise_CND);
+		LOAD_GSS_Low_Voc_Fact = EEPROM_READ_FLOAT(&EROM_LOAD_GSS_Low_Voc_Fact);
+		LOAD_GSS_High_Voc_Fact = EEPROM_READ_FLOAT(&EROM_LOAD_GSS_High_Voc_Fact);
+		LOAD_GSS_Drift_Fact = EEPROM_READ_FLOAT(&EROM_LOAD_GSS_Drift_Fact);
+		LOAD_FVoc_Fact = EEPROM_READ_FLOAT(&EROM_LOAD_FVoc_Fact);
+		LOAD_FVoc_Interval = EEPROM_READ_UINT16(&EROM_LOAD_FVoc_Interval);
+		LOAD_FVoc_Settle_ms = EEPROM_READ_UINT8(&EROM_LOAD_FVoc_Settle_ms);
+		IV_Mini_Points = EEPROM_READ_UINT8(&EROM_IV_Mini_Points);
+		IV_Mini_Window_Fact = EEPROM_READ_FLOAT(&EROM_IV_Mini_Window_Fact);
+		IV_Ramp_Rate = EEPROM_READ_FLOAT(&EROM_IV_Ramp_Rate);
+		IV_Seq_SE_Target = EEPROM_READ_FLOAT(&EROM_IV_Seq_SE_Target);
+		IV_Seq_Max_Sets = EEPROM_READ_UINT8(&EROM_IV_Seq_Max_Sets);
+		IV_Dwell_Learn = EEPROM_READ_UINT8(&EROM_IV_Dwell_Learn);
+		IV_Dwell_Tau_Mult = EEPROM_READ_FLOAT(&EROM_IV_Dwell_Tau_Mult);
+		IV_Preemph_Gain = EEPROM_READ_FLOAT(&EROM_IV_Preemph_Gain);
+		IV_Preemph_Tau_us = EEPROM_READ_FLOAT(&EROM_IV_Preemph_Tau_us);
+		IV_Point_Flags_On = EEPROM_READ_UINT8(&EROM_IV_Point_Flags_On);
+		IV_Seg_Count = EEPROM_READ_UINT8(&EROM_IV_Seg_Count);
+		if (IV_Seg_Count > IV_SEG_MAX) IV_Seg_Count = IV_SEG_MAX;
+		for (i=0; i < IV_SEG_MAX; i++) {
+			IV_Seg_End_Voc_Fact[i] = EEPROM_READ_FLOAT(&EROM_IV_Seg_End_Voc_Fact[i]);
+			IV_Seg_Points[i] = EEPROM_READ_UINT8(&EROM_IV_Seg_Points[i]);
+			if (IV_Seg_Points[i] > MAX_IV_POINTS) IV_Seg_Points[i] = MAX_IV_POINTS;
+			IV_Seg_Delay_ms[i] = EEPROM_READ_UINT16(&EROM_IV_Seg_Delay_ms[i]);
+			IV_Seg_Nu_AVR_VoltCurr[i] = EEPROM_READ_UINT8(&EROM_IV_Seg_Nu_AVR_VoltCurr[i]);
+			if (IV_Seg_Nu_AVR_VoltCurr[i] == 0) IV_Seg_Nu_AVR_VoltCurr[i] = 1; // prevent division by zero
+		}
+		IV_Sched_Interval_s = EEPROM_READ_UINT16(&EROM_IV_Sched_Interval_s);
+		IV_Sched_Stagger_s = EEPROM_READ_UINT16(&EROM_IV_Sched_Stagger_s);
 		LOAD_CurrT_Max_Step_CND = EEPROM_READ_FLOAT(&EROM_LOAD_CurrT_Max_Step_CND);
-		LOAD_CurrT_Min_Step_CND = EEPROM_READ_FLOAT(&EROM_LOAD_CurrT_Min_Step_CND);
-		LOAD_CurrT_Step_Increase_Fact = EEPROM_READ_FLOAT(&EROM_LOAD_CurrT_Step_Increase_Fact);
-		LOAD_CurrT_Step_Reduction_Fact = EEPROM_READ_FLOAT(&EROM_LOAD_CurrT_Step_Reduction_Fact);
 		LOAD_CurrT_Tolerance_CND = EEPROM_READ_FLOAT(&EROM_LOAD_CurrT_Tolerance_CND);
+		LOAD_CurrT_PID_Kp = EEPROM_READ_FLOAT(&EROM_LOAD_CurrT_PID_Kp);
+		LOAD_CurrT_PID_Ki = EEPROM_READ_FLOAT(&EROM_LOAD_CurrT_PID_Ki);
+		LOAD_CurrT_PID_Kd = EEPROM_READ_FLOAT(&EROM_LOAD_CurrT_PID_Kd);
+		LOAD_CurrT_FF_Max_Age_s = EEPROM_READ_UINT16(&EROM_LOAD_CurrT_FF_Max_Age_s);
+		PV_Pow_Setpoint = EEPROM_READ_FLOAT(&EROM_PV_Pow_Setpoint);
+		LOAD_Pow_Isc_Side = EEPROM_READ_UINT8(&EROM_LOAD_Pow_Isc_Side);
+		PV_Res_Setpoint = EEPROM_READ_FLOAT(&EROM_PV_Res_Setpoint);
+		LOAD_Prof_Count = EEPROM_READ_UINT8(&EROM_LOAD_Prof_Count);
+		if (LOAD_Prof_Count > LOAD_PROF_MAX_STEPS) LOAD_Prof_Count = LOAD_PROF_MAX_STEPS;
+		for (i=0; i < LOAD_PROF_MAX_STEPS; i++) {
+			LOAD_Prof_Mode[i] = EEPROM_READ_UINT8(&EROM_LOAD_Prof_Mode[i]);
+			LOAD_Prof_Setpoint[i] = EEPROM_READ_FLOAT(&EROM_LOAD_Prof_Setpoint[i]);
+			LOAD_Prof_Duration_s[i] = EEPROM_READ_UINT16(&EROM_LOAD_Prof_Duration_s[i]);
+			LOAD_Prof_Repeat[i] = EEPROM_READ_UINT8(&EROM_LOAD_Prof_Repeat[i]);
+		}
 		SysControl = EEPROM_READ_UINT8(&EROM_SysControl);
 		PV_Mode_CTR = EEPROM_READ_UINT8(&EROM_PV_Mode_CTR);
 		PV_Volt_Setpoint = EEPROM_READ_FLOAT(&EROM_PV_Volt_Setpoint);
@@ -178,11 +224,61 @@ void EEPROM_LOAD_VAL_CONFIG() {
 		LOAD_MPPT_Step_Reduction_Fact = 0.6;
 		LOAD_MPPT_Tolerance_CND = 1000.0 * 1000.0;
 		LOAD_MPPT_Timer_Update_Delay = 1;
+		LOAD_MPPT_Mini_IV_Interval = 0;
+		LOAD_IncC_Cond_Band = 0.02;
+		LOAD_IncC_Volt_Noise_CND = 100.0;
+		LOAD_IncC_Curr_Noise_CND = 100.0;
+		LOAD_GSS_Low_Voc_Fact = 0.5;
+		LOAD_GSS_High_Voc_Fact = 0.95;
+		LOAD_GSS_Drift_Fact = 0.05;
+		LOAD_FVoc_Fact = 0.0;
+		LOAD_FVoc_Interval = 400;
+		LOAD_FVoc_Settle_ms = 5;
+		IV_Mini_Points = 5;
+		IV_Mini_Window_Fact = 0.05;
+		IV_Ramp_Rate = 0.0;
+		IV_Seq_SE_Target = 0.0;
+		IV_Seq_Max_Sets = 20;
+		IV_Dwell_Learn = 0;
+		IV_Dwell_Tau_Mult = 5.0;
+		IV_Preemph_Gain = 0.0;
+		IV_Preemph_Tau_us = 200.0;
+		IV_Point_Flags_On = 0;
+		IV_Seg_Count = 3;
+		IV_Seg_End_Voc_Fact[0] = 0.6;
+		IV_Seg_End_Voc_Fact[1] = 0.95;
+		IV_Seg_End_Voc_Fact[2] = 1.01;
+		IV_Seg_End_Voc_Fact[3] = 1.01;
+		IV_Seg_Points[0] = 20;
+		IV_Seg_Points[1] = 50;
+		IV_Seg_Points[2] = 20;
+		IV_Seg_Points[3] = 10;
+		IV_Seg_Delay_ms[0] = 5;
+		IV_Seg_Delay_ms[1] = 10;
+		IV_Seg_Delay_ms[2] = 5;
+		IV_Seg_Delay_ms[3] = 5;
+		IV_Seg_Nu_AVR_VoltCurr[0] = 20;
+		IV_Seg_Nu_AVR_VoltCurr[1] = 50;
+		IV_Seg_Nu_AVR_VoltCurr[2] = 20;
+		IV_Seg_Nu_AVR_VoltCurr[3] = 20;
+		IV_Sched_Interval_s = 0;
+		IV_Sched_Stagger_s = 0;
 		LOAD_CurrT_Max_Step_CND = 1000.0;
-		LOAD_CurrT_Min_Step_CND = 1.0;
-		LOAD_CurrT_Step_Increase_Fact = 1.2;
-		LOAD_CurrT_Step_Reduction_Fact = 0.6;
 		LOAD_CurrT_Tolerance_CND = 10.0;
+		LOAD_CurrT_PID_Kp = 0.5;
+		LOAD_CurrT_PID_Ki = 0.2;
+		LOAD_CurrT_PID_Kd = 0.0;
+		LOAD_CurrT_FF_Max_Age_s = 600;
+		PV_Pow_Setpoint = 0.0;
+		LOAD_Pow_Isc_Side = 0;
+		PV_Res_Setpoint = 0.0;
+		LOAD_Prof_Count = 0;
+		for (i=0; i < LOAD_PROF_MAX_STEPS; i++) {
+			LOAD_Prof_Mode[i] = 0;
+			LOAD_Prof_Setpoint[i] = 0.0;
+			LOAD_Prof_Duration_s[i] = 0;
+			LOAD_Prof_Repeat[i] = 0;
+		}
 		SysControl = 0;
 		PV_Mode_CTR = 0;
 		PV_Volt_Setpoint = 0.0;
@@ -1140,6 +1236,21 @@ void EEPROM_ACCESS_UART(char * EEPROM_Command, uint8_t EEPROM_Write){
 		COM_EROM_ACCESS_UINT16(&EROM_LOAD_MPPT_Timer_Update_Delay, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
 		goto EEPROM_WRITE_EEROM_END;
 	}
+	// WRITE uint16 EROM_LOAD_MPPT_Mini_IV_Interval
+	if (EEPROM_Adr == 156) {
+		COM_EROM_ACCESS_UINT16(&EROM_LOAD_MPPT_Mini_IV_Interval, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE uint8 EROM_IV_Mini_Points
+	if (EEPROM_Adr == 157) {
+		COM_EROM_ACCESS_UINT8(&EROM_IV_Mini_Points, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE float EROM_IV_Mini_Window_Fact
+	if (EEPROM_Adr == 158) {
+		COM_EROM_ACCESS_FLOAT(&EROM_IV_Mini_Window_Fact, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
 	
 	//###########################
 	// Current Tracker control variables
@@ -1149,21 +1260,7 @@ void EEPROM_ACCESS_UART(char * EEPROM_Command, uint8_t EEPROM_Write){
 		COM_EROM_ACCESS_FLOAT(&EROM_LOAD_CurrT_Max_Step_CND, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
 		goto EEPROM_WRITE_EEROM_END;
 	}
-	// WRITE float EROM_LOAD_CurrT_Min_Step_CND
-	if (EEPROM_Adr == 161) {
-		COM_EROM_ACCESS_FLOAT(&EROM_LOAD_CurrT_Min_Step_CND, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
-		goto EEPROM_WRITE_EEROM_END;
-	}
-	// WRITE float EROM_LOAD_CurrT_Step_Increase_Fact
-	if (EEPROM_Adr == 162) {
-		COM_EROM_ACCESS_FLOAT(&EROM_LOAD_CurrT_Step_Increase_Fact, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
-		goto EEPROM_WRITE_EEROM_END;
-	}
-	// WRITE float EROM_LOAD_CurrT_Step_Reduction_Fact
-	if (EEPROM_Adr == 163) {
-		COM_EROM_ACCESS_FLOAT(&EROM_LOAD_CurrT_Step_Reduction_Fact, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
-		goto EEPROM_WRITE_EEROM_END;
-	}
+	// 161 ... 163 reserved
 	// WRITE float EROM_LOAD_CurrT_Tolerance_CND
 	if (EEPROM_Adr == 164) {
 		COM_EROM_ACCESS_FLOAT(&EROM_LOAD_CurrT_Tolerance_CND, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
@@ -1193,6 +1290,16 @@ void EEPROM_ACCESS_UART(char * EEPROM_Command, uint8_t EEPROM_Write){
 		 COM_EROM_ACCESS_FLOAT(&EROM_PV_Curr_Setpoint, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
 		goto EEPROM_WRITE_EEROM_END;
 	}
+	// WRITE uint16 EROM_IV_Sched_Interval_s
+	if (EEPROM_Adr == 169) {
+		COM_EROM_ACCESS_UINT16(&EROM_IV_Sched_Interval_s, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE uint16 EROM_IV_Sched_Stagger_s
+	if (EEPROM_Adr == 170) {
+		COM_EROM_ACCESS_UINT16(&EROM_IV_Sched_Stagger_s, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
 	
 	//###########################
 	// Fan control Variables
@@ -1237,6 +1344,180 @@ void EEPROM_ACCESS_UART(char * EEPROM_Command, uint8_t EEPROM_Write){
 		COM_EROM_ACCESS_UINT16(&EROM_FAN_Switch_Timer_Max, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
 		goto EEPROM_WRITE_EEROM_END;
 	}
+	
+	//###########################
+	// IV sweep profile segment Variables
+	//---------------------------
+	// WRITE uint8 EROM_IV_Seg_Count
+	if (EEPROM_Adr == 183) {
+		COM_EROM_ACCESS_UINT8(&EROM_IV_Seg_Count, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE float EROM_IV_Seg_End_Voc_Fact[0 ... 3]
+	if ((EEPROM_Adr >= 184) && (EEPROM_Adr < (184 + IV_SEG_MAX))) {
+		COM_EROM_ACCESS_FLOAT(&EROM_IV_Seg_End_Voc_Fact[EEPROM_Adr - 184], EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE uint8 EROM_IV_Seg_Points[0 ... 3]
+	if ((EEPROM_Adr >= 188) && (EEPROM_Adr < (188 + IV_SEG_MAX))) {
+		COM_EROM_ACCESS_UINT8(&EROM_IV_Seg_Points[EEPROM_Adr - 188], EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE uint16 EROM_IV_Seg_Delay_ms[0 ... 3]
+	if ((EEPROM_Adr >= 192) && (EEPROM_Adr < (192 + IV_SEG_MAX))) {
+		COM_EROM_ACCESS_UINT16(&EROM_IV_Seg_Delay_ms[EEPROM_Adr - 192], EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE uint8 EROM_IV_Seg_Nu_AVR_VoltCurr[0 ... 3]
+	if ((EEPROM_Adr >= 196) && (EEPROM_Adr < (196 + IV_SEG_MAX))) {
+		COM_EROM_ACCESS_UINT8(&EROM_IV_Seg_Nu_AVR_VoltCurr[EEPROM_Adr - 196], EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE float EROM_IV_Ramp_Rate
+	if (EEPROM_Adr == 200) {
+		COM_EROM_ACCESS_FLOAT(&EROM_IV_Ramp_Rate, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE float EROM_IV_Seq_SE_Target
+	if (EEPROM_Adr == 201) {
+		COM_EROM_ACCESS_FLOAT(&EROM_IV_Seq_SE_Target, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE uint8 EROM_IV_Seq_Max_Sets
+	if (EEPROM_Adr == 202) {
+		COM_EROM_ACCESS_UINT8(&EROM_IV_Seq_Max_Sets, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE uint8 EROM_IV_Dwell_Learn
+	if (EEPROM_Adr == 203) {
+		COM_EROM_ACCESS_UINT8(&EROM_IV_Dwell_Learn, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE float EROM_IV_Dwell_Tau_Mult
+	if (EEPROM_Adr == 204) {
+		COM_EROM_ACCESS_FLOAT(&EROM_IV_Dwell_Tau_Mult, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE float EROM_IV_Preemph_Gain
+	if (EEPROM_Adr == 205) {
+		COM_EROM_ACCESS_FLOAT(&EROM_IV_Preemph_Gain, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE float EROM_IV_Preemph_Tau_us
+	if (EEPROM_Adr == 206) {
+		COM_EROM_ACCESS_FLOAT(&EROM_IV_Preemph_Tau_us, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE uint8 EROM_IV_Point_Flags_On
+	if (EEPROM_Adr == 207) {
+		COM_EROM_ACCESS_UINT8(&EROM_IV_Point_Flags_On, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE float EROM_LOAD_IncC_Cond_Band
+	if (EEPROM_Adr == 208) {
+		COM_EROM_ACCESS_FLOAT(&EROM_LOAD_IncC_Cond_Band, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE float EROM_LOAD_IncC_Volt_Noise_CND
+	if (EEPROM_Adr == 209) {
+		COM_EROM_ACCESS_FLOAT(&EROM_LOAD_IncC_Volt_Noise_CND, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE float EROM_LOAD_IncC_Curr_Noise_CND
+	if (EEPROM_Adr == 210) {
+		COM_EROM_ACCESS_FLOAT(&EROM_LOAD_IncC_Curr_Noise_CND, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE float EROM_LOAD_GSS_Low_Voc_Fact
+	if (EEPROM_Adr == 211) {
+		COM_EROM_ACCESS_FLOAT(&EROM_LOAD_GSS_Low_Voc_Fact, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE float EROM_LOAD_GSS_High_Voc_Fact
+	if (EEPROM_Adr == 212) {
+		COM_EROM_ACCESS_FLOAT(&EROM_LOAD_GSS_High_Voc_Fact, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE float EROM_LOAD_GSS_Drift_Fact
+	if (EEPROM_Adr == 213) {
+		COM_EROM_ACCESS_FLOAT(&EROM_LOAD_GSS_Drift_Fact, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE float EROM_LOAD_CurrT_PID_Kp
+	if (EEPROM_Adr == 214) {
+		COM_EROM_ACCESS_FLOAT(&EROM_LOAD_CurrT_PID_Kp, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE float EROM_LOAD_CurrT_PID_Ki
+	if (EEPROM_Adr == 215) {
+		COM_EROM_ACCESS_FLOAT(&EROM_LOAD_CurrT_PID_Ki, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE float EROM_LOAD_CurrT_PID_Kd
+	if (EEPROM_Adr == 216) {
+		COM_EROM_ACCESS_FLOAT(&EROM_LOAD_CurrT_PID_Kd, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE uint16 EROM_LOAD_CurrT_FF_Max_Age_s
+	if (EEPROM_Adr == 217) {
+		COM_EROM_ACCESS_UINT16(&EROM_LOAD_CurrT_FF_Max_Age_s, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE float EROM_PV_Pow_Setpoint
+	if (EEPROM_Adr == 218) {
+		COM_EROM_ACCESS_FLOAT(&EROM_PV_Pow_Setpoint, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE uint8 EROM_LOAD_Pow_Isc_Side
+	if (EEPROM_Adr == 219) {
+		COM_EROM_ACCESS_UINT8(&EROM_LOAD_Pow_Isc_Side, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE float EROM_PV_Res_Setpoint
+	if (EEPROM_Adr == 220) {
+		COM_EROM_ACCESS_FLOAT(&EROM_PV_Res_Setpoint, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE float EROM_LOAD_FVoc_Fact
+	if (EEPROM_Adr == 221) {
+		COM_EROM_ACCESS_FLOAT(&EROM_LOAD_FVoc_Fact, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE uint16 EROM_LOAD_FVoc_Interval
+	if (EEPROM_Adr == 222) {
+		COM_EROM_ACCESS_UINT16(&EROM_LOAD_FVoc_Interval, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE uint8 EROM_LOAD_FVoc_Settle_ms
+	if (EEPROM_Adr == 223) {
+		COM_EROM_ACCESS_UINT8(&EROM_LOAD_FVoc_Settle_ms, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE uint8 EROM_LOAD_Prof_Count
+	if (EEPROM_Adr == 224) {
+		COM_EROM_ACCESS_UINT8(&EROM_LOAD_Prof_Count, EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE uint8 EROM_LOAD_Prof_Mode[0 ... 5]
+	if ((EEPROM_Adr >= 225) && (EEPROM_Adr < (225 + LOAD_PROF_MAX_STEPS))) {
+		COM_EROM_ACCESS_UINT8(&EROM_LOAD_Prof_Mode[EEPROM_Adr - 225], EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE float EROM_LOAD_Prof_Setpoint[0 ... 5]
+	if ((EEPROM_Adr >= 231) && (EEPROM_Adr < (231 + LOAD_PROF_MAX_STEPS))) {
+		COM_EROM_ACCESS_FLOAT(&EROM_LOAD_Prof_Setpoint[EEPROM_Adr - 231], EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE uint16 EROM_LOAD_Prof_Duration_s[0 ... 5]
+	if ((EEPROM_Adr >= 237) && (EEPROM_Adr < (237 + LOAD_PROF_MAX_STEPS))) {
+		COM_EROM_ACCESS_UINT16(&EROM_LOAD_Prof_Duration_s[EEPROM_Adr - 237], EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
+	// WRITE uint8 EROM_LOAD_Prof_Repeat[0 ... 5]
+	if ((EEPROM_Adr >= 243) && (EEPROM_Adr < (243 + LOAD_PROF_MAX_STEPS))) {
+		COM_EROM_ACCESS_UINT8(&EROM_LOAD_Prof_Repeat[EEPROM_Adr - 243], EEPROM_Write, EEPROM_Val_Char, EEPROM_Command);
+		goto EEPROM_WRITE_EEROM_END;
+	}
 		
 	AddEnd_String(EEPROM_Command, "?"); // return ? as error if not found
 
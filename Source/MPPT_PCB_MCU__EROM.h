@@ -18,7 +18,7 @@
 //===========================================================================================
 // Definitions and constants
 #define EEPROM_ADR_LENGH 5		// Address length of EEPROM
-#define EEMEM_WRITE_VALUE 165 	// Value testing EEMEM written & valid
+#define EEMEM_WRITE_VALUE 166 	// Value testing EEMEM written & valid, changed when the EEMEM layout changes
 
 //===========================================================================================
 // EXTERN VARIABLES and STRUCTURES
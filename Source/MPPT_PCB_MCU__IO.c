@@ -325,6 +325,18 @@ void Set_DAC_Output_Volts(float Voltage){
 	/* converts the voltage to RAW DAC counts, dependent of measurement/controller range 
 	- the actual range is controlled by the analog input & the output updates with changes by new function calls*/
 	uint16_t DAC_Counts;
+	
+	// set & send
+	DAC_Counts = Get_DAC_Counts_From_Volts(Voltage);
+	PV_Volt_DAC_ACT = Voltage;
+	Set_DAC_Output_RAW(DAC_Counts);
+
+}
+
+//-------------------------------------------------------------------------------------------
+// DAC counts from voltage
+uint16_t Get_DAC_Counts_From_Volts(float Voltage){
+	/* converts the voltage to RAW DAC counts with the calibration of the actual voltage range, limited to the DAC range */
 	float Tmp_Float;
 	
 	// calculate digital counts at the DAC
@@ -336,11 +348,7 @@ void Set_DAC_Output_Volts(float Voltage){
 	else if (Tmp_Float < CAL_DAC_A0) {
 		Tmp_Float = CAL_DAC_A0;
 	}
-	// set & send
-	DAC_Counts = (uint16_t) (Tmp_Float);
-	PV_Volt_DAC_ACT = Voltage;
-	Set_DAC_Output_RAW(DAC_Counts);
-
+	return (uint16_t) (Tmp_Float);
 }
 
 //-------------------------------------------------------------------------------------------
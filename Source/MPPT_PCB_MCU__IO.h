@@ -170,6 +170,7 @@ uint32_t ADC_Convert_Avr_MAX11163(uint16_t Nu_Avr);
 uint32_t ADC_Convert_Avr_OLUL_MAX11163(uint16_t Nu_Avr);
 
 void Set_DAC_Output_Volts(float Voltage);
+uint16_t Get_DAC_Counts_From_Volts(float Voltage);
 void Set_DAC_Output_RAW(uint16_t DAC_val);
 
 void DIOExp_config_init();
@@ -27,6 +27,14 @@
 //===========================================================================================
 // MEMSPACE DATA
 
+// quarter wave sine table, sin(0 ... pi/2) x 65535, for the cosine distributed IV points
+PROGMEM const uint16_t IV_SINE_QUARTER[IV_SINE_TABLE_SIZE + 1] = {
+	0, 1608, 3216, 4821, 6424, 8022, 9616, 11204, 12785, 14359, 15924, 17479, 19024,
+	20557, 22078, 23586, 25079, 26557, 28020, 29465, 30893, 32302, 33692, 35061, 36409, 37736,
+	39039, 40319, 41575, 42806, 44011, 45189, 46340, 47464, 48558, 49624, 50659, 51664, 52638,
+	53580, 54490, 55367, 56211, 57021, 57797, 58537, 59243, 59913, 60546, 61144, 61704, 62227,
+	62713, 63161, 63571, 63943, 64276, 64570, 64826, 65042, 65219, 65357, 65456, 65515, 65535
+};
 
 //===========================================================================================
 // VARIABLES and STRUCTURES
@@ -45,11 +53,51 @@ volatile uint16_t IV_Setup_Signal_Set_Time;
 volatile uint8_t IV_Point_Meas_Nu_AVR_Sets;
 volatile uint8_t IV_Point_Meas_Nu_AVR_VoltCurr;
 volatile uint8_t IV_Report;
+volatile uint8_t IV_Data_Points;		// number of points in the IV data buffer of last measurement
+volatile uint8_t IV_Data_Content;		// additional data recorded with the IV points of last measurement
+volatile float IV_Hyst_Index;
+volatile float IV_Sweep_Energy_Lost;		// energy lost during last IV measurement compared to start point [J]
+volatile float IV_Sweep_Power_Ticks;		// energy delivered during IV measurement in [W * timer ticks]
+volatile uint32_t IV_Sweep_Tick_Last;
+volatile uint32_t IV_Block_Ticks;		// main timer ticks the load control was blocked by IV sweeps & Voc samples, cleared by the energy integration
+volatile float IV_Block_Power_Ticks;		// energy delivered while blocked in [W * timer ticks]
+volatile uint8_t IV_Mini_Points;
+volatile float IV_Mini_Window_Fact;
+volatile float IV_Ramp_Rate;		// slew rate of the continuous ramp IV measurement in [V/s], 0 is off
+volatile float IV_Seq_SE_Target;	// standard error target of sequential point averaging in [ADC counts], 0 is off
+volatile uint8_t IV_Seq_Max_Sets;	// maximum number of measurement sets of sequential point averaging
+volatile uint8_t IV_Dwell_Learn;		// learn dwell times per voltage region from settle traces, 0 is off
+volatile float IV_Dwell_Tau_Mult;	// learned dwell time as multiple of the settling time constant
+volatile uint8_t IV_Point_Flags_On;	// return quality flags of each IV point with the IV data, 0 is off
+volatile float IV_Preemph_Gain;		// DAC overdrive past the set-point as fraction of the voltage step, 0 is off
+volatile float IV_Preemph_Tau_us;	// first order time constant of driver & device for the DAC overdrive time
+volatile float IV_Dwell_Tau_ms[IV_DWELL_REGIONS];	// largest settling time constant per region of the running sweep, negative if unknown
+volatile uint16_t IV_Dwell_Map_ms[IV_DWELL_REGIONS];	// learned dwell time per region, 0 if not learned
+volatile float IV_Voc_Last;			// Voc of last Voc range search (IV measurement or MPPT start), used for the time prediction of ramps & mini sweep window
+volatile uint8_t IV_Seg_Count;		// number of IV sweep profile segments
+volatile float IV_Seg_End_Voc_Fact[IV_SEG_MAX];	// segment end voltage as fraction of Voc
+volatile uint8_t IV_Seg_Points[IV_SEG_MAX];
+volatile uint16_t IV_Seg_Delay_ms[IV_SEG_MAX];
+volatile uint8_t IV_Seg_Nu_AVR_VoltCurr[IV_SEG_MAX];
+volatile uint16_t IV_Sched_Interval_s;	// scheduled IV measurement interval in [s], 0 is off
+volatile uint16_t IV_Sched_Stagger_s;	// scheduled IV measurement start delay per com address in [s]
+volatile uint32_t IV_Sched_Tick_Next;	// main timer tick of next scheduled IV measurement
+volatile uint16_t IV_Curve_Count;		// number of IV curves measured since start-up
+volatile uint16_t IV_Curve_Lost;		// number of IV curves overwritten before read by host
+volatile uint32_t IV_Curve_Tick;		// main timer tick at start of the IV curve in the buffer
+volatile uint32_t IV_Time_Predicted_ms;	// predicted duration of last IV measurement
+volatile uint32_t IV_Time_Actual_ms;	// measured duration of last IV measurement
 volatile float IV_Voc_Overshoot_Fact;
 volatile float IV_Cos_Max_Phase;
 volatile float PV_IV_Current[MAX_IV_POINTS];
 volatile float PV_IV_Voltage[MAX_IV_POINTS];
+volatile uint8_t PV_IV_Curr_Range[MAX_IV_POINTS];	// current range ID each IV point was measured in
+volatile uint8_t PV_IV_Nu_Sets[MAX_IV_POINTS];	// number of measurement sets of each IV point with sequential averaging
+volatile uint16_t PV_IV_Std_Err[MAX_IV_POINTS];	// standard error of each IV point in [ADC counts / IV_SEQ_SE_SCALE]
+volatile uint8_t PV_IV_Flags[MAX_IV_POINTS];	// quality flags of each IV point
 volatile float PV_DAC_Points[MAX_IV_POINTS];
+volatile uint16_t PV_DAC_Counts[MAX_IV_POINTS];	// DAC counts of the IV points, calculated before the sweep
+volatile bool IV_Stream_Sweep;		// IV points of the running sweep are streamed to the host
 volatile uint8_t IV_Range_Volt_Last;
 volatile uint8_t IV_Range_Curr_Last;
 
@@ -62,6 +110,23 @@ EEMEM float EROM_IV_Voc_Overshoot_Fact = 1.01;
 EEMEM uint16_t EROM_IV_Point_Set_Delay_ms = 5;
 EEMEM uint8_t EROM_IV_Point_Meas_Nu_AVR_Sets = 1;
 EEMEM uint8_t EROM_IV_Point_Meas_Nu_AVR_VoltCurr = 50;
+EEMEM uint8_t EROM_IV_Mini_Points = 5;
+EEMEM float EROM_IV_Mini_Window_Fact = 0.05;
+EEMEM float EROM_IV_Ramp_Rate = 0.0;
+EEMEM float EROM_IV_Seq_SE_Target = 0.0;
+EEMEM uint8_t EROM_IV_Seq_Max_Sets = 20;
+EEMEM uint8_t EROM_IV_Dwell_Learn = 0;
+EEMEM float EROM_IV_Dwell_Tau_Mult = 5.0;
+EEMEM float EROM_IV_Preemph_Gain = 0.0;
+EEMEM uint8_t EROM_IV_Point_Flags_On = 0;
+EEMEM float EROM_IV_Preemph_Tau_us = 200.0;
+EEMEM uint8_t EROM_IV_Seg_Count = 3;
+EEMEM float EROM_IV_Seg_End_Voc_Fact[IV_SEG_MAX] = {0.6, 0.95, 1.01, 1.01};	// sparse plateau, dense knee, sparse Voc
+EEMEM uint8_t EROM_IV_Seg_Points[IV_SEG_MAX] = {20, 50, 20, 10};
+EEMEM uint16_t EROM_IV_Seg_Delay_ms[IV_SEG_MAX] = {5, 10, 5, 5};
+EEMEM uint8_t EROM_IV_Seg_Nu_AVR_VoltCurr[IV_SEG_MAX] = {20, 50, 20, 20};
+EEMEM uint16_t EROM_IV_Sched_Interval_s = 0;
+EEMEM uint16_t EROM_IV_Sched_Stagger_s = 0;
 
 //===========================================================================================
 // FUNCTIONS
@@ -73,17 +138,55 @@ void PV_IV_MEAS(){
 	- first sets optimal voltage range at VOC and optimal current range at ISC
 	- then calculates all Voltage points (linear or cosine distribution)
 	- then each point is measured with specific timing
+	- in hysteresis mode the curve is measured again straight after in the opposite direction
+	- in MPP split mode the curve is measured from the start point up to Voc, then down to Isc, and sorted to rising voltage afterwards
+	- in segment mode the points, delay & averaging are set per segment of the curve, hysteresis & MPP split are ignored
+	- in current step mode the voltage points are placed for equal current steps, from a coarse pre-sweep
+	- with a ramp rate set, the DAC is ramped continuously while sampling, all other modes except reverse are ignored
 	*/
 	// need those variables
 	float Voc;
-	uint8_t i, k;
+	uint8_t i;
 	uint16_t j;
 	bool STOP_IV;
+	uint8_t Sweep_Points;
+	uint8_t Split_Point;
+	uint32_t Sweep_Tick_Start;
+	float Sweep_Power_Start;
+	bool Seg_Sweep;
+	bool Ramp_Sweep;
+	bool Set_Point_Back;
 	
 	
 	// reset IV result result flags
 	IV_Report = 0;
+	IV_Hyst_Index = 0;
 	STOP_IV = false;
+	Set_Point_Back = false;
+	
+	// count IV curves the host did not collect before overwritten
+	if (is_NewIvDataAvailable) IV_Curve_Lost++;
+	
+	// continuous ramp sweep ignores all other modes except reverse
+	Ramp_Sweep = (IV_Ramp_Rate > 0);
+	Seg_Sweep = (is_IV_Mode__Seg_Sweep && (IV_Seg_Count > 0) && (IV_Seg_Points[0] > 0) && !Ramp_Sweep);
+	
+	// dynamic current ranging changes range during the sweep, so record the range of each point
+	IV_Data_Content = 0;
+	if (is_IV_Mode__Dyn_Curr_Range && !is_manual_Curr_Range_Set && !Ramp_Sweep) SET__IV_Data_Curr_Range;
+	// sequential averaging measures each point until its standard error is low enough, so record sets & error of each point
+	if ((IV_Seq_SE_Target > 0) && !Ramp_Sweep) SET__IV_Data_Seq_Stats;
+	if (IV_Point_Flags_On && !Ramp_Sweep) SET__IV_Data_Point_Flags;
+	
+	// hysteresis sweep stores both directions in the IV buffer, so each direction gets half
+	Sweep_Points = IV_Meas_Points;
+	if (is_IV_Mode__Hyst_Sweep && !is_IV_Mode__MPP_Split && !Seg_Sweep && !Ramp_Sweep && (Sweep_Points > (MAX_IV_POINTS / 2))) Sweep_Points = MAX_IV_POINTS / 2;
+	
+	// record power & time at start to calculate energy lost during the IV measurement
+	Sweep_Power_Start = AI_Volt * AI_Curr_Corr;
+	Sweep_Tick_Start = Get_Timer_Main_Ticks();
+	IV_Sweep_Power_Ticks = 0;
+	IV_Curve_Tick = Sweep_Tick_Start;
 	
 	// save old control values to restore at end
 	uint8_t Curr_Range_Old;
@@ -95,29 +198,38 @@ void PV_IV_MEAS(){
 	
 	// calc variables for averaging (not wanting to do this 100 times)
 	float Volt_AVR_Mult, Curr_AVR_Mult;
-	if (is_IV_Mode__Asym_Volt) {
-		Volt_AVR_Mult = 1.0 / ((float) (IV_Point_Meas_Nu_AVR_VoltCurr) * ((float) (IV_Point_Meas_Nu_AVR_Sets) + 1.0));
-		Curr_AVR_Mult = 1.0 / ((float) (IV_Point_Meas_Nu_AVR_VoltCurr) * (float) (IV_Point_Meas_Nu_AVR_Sets));
-	}
-	else {
-		Volt_AVR_Mult = 1.0 / ((float) (IV_Point_Meas_Nu_AVR_VoltCurr) * (float) (IV_Point_Meas_Nu_AVR_Sets));
-		Curr_AVR_Mult = Volt_AVR_Mult;
-	}
+	IV_MEAS__Calc_AVR_Mult(&Volt_AVR_Mult, &Curr_AVR_Mult);
 	if (IV_Point_Set_Delay_ms >= IV_Setup_Max_Delay_For_Mul) IV_Setup_Signal_Set_Time = 60000;
 	else IV_Setup_Signal_Set_Time = IV_Point_Set_Delay_ms * IV_Setup_Signal_Set_Multiplier + IV_Range_Set_Settle_Time_ms;
+	// predict duration before ranges are changed, to be compared with the actual duration
+	IV_Time_Predicted_ms = IV_MEAS__Predict_Time_ms();
 		
 	// Get optimal ranges for voltage and current + record VOC
 	Voc = IV_MEAS__Get_Voc_Set_Optimum_Range();
 	IV_MEAS__Get_Curr_Optimum_Range();
-			
+	
 	// Calculate the measurement voltage output points
-	if (is_IV_Mode__Cos_Sweep) {
+	if (Ramp_Sweep) {
+		// only start & end point needed for the ramp
+		Voc = IV_Voc_Overshoot_Fact * Voc; // measure over VOC to get to get down to I=0
+		PV_DAC_Points[0] = 0;
+		PV_DAC_Points[Sweep_Points-1] = Voc;
+	}
+	else if (Seg_Sweep) {
+		Sweep_Points = IV_MEAS__Calc_Segment_Points(Voc);
+	}
+	else if (is_IV_Mode__Curr_Step) {
+		// DAC is still at Isc from the current range search, ready for the pre-sweep
+		Voc = IV_Voc_Overshoot_Fact * Voc; // measure over VOC to get to get down to I=0
+		IV_MEAS__Calc_Curr_Step_Points(Voc, Sweep_Points, Volt_AVR_Mult, Curr_AVR_Mult);
+	}
+	else if (is_IV_Mode__Cos_Sweep) {
 		float Phase_Angle, Cos_End_Val, Phase_Act;
 		// calc phase angle
-		Phase_Angle = IV_Cos_Max_Phase / (float) (IV_Meas_Points-1);
+		Phase_Angle = IV_Cos_Max_Phase / (float) (Sweep_Points-1);
 		Voc = IV_Voc_Overshoot_Fact * Voc; // measure over VOC to get to get down to I=0
 		// determine cos end value (sin really) & scale Voc value to reach endpoint
-		Cos_End_Val = sin(Phase_Angle * (float) (IV_Meas_Points-1));
+		Cos_End_Val = IV_Get_Sine(Phase_Angle * (float) (Sweep_Points-1));
 		if (IV_Cos_Max_Phase <= 1.57079) {
 			// first quarter only
 			Voc = Voc * 1 / Cos_End_Val;
@@ -127,30 +239,43 @@ void PV_IV_MEAS(){
 			Voc = Voc * 1 / (2 - Cos_End_Val);
 		}
 		// calculate points
-		for (i=0; i < IV_Meas_Points; i++) {
+		for (i=0; i < Sweep_Points; i++) {
 			// calc points with cos distribution
 			Phase_Act = Phase_Angle * i;
 			if (Phase_Act <= 1.57079) {
 				// first quarter
-				PV_DAC_Points[i] = Voc * sin(Phase_Act);
+				PV_DAC_Points[i] = Voc * IV_Get_Sine(Phase_Act);
 			}
 			else {
 				// second quarter
-				PV_DAC_Points[i] = Voc * (2 - sin(Phase_Act));
+				PV_DAC_Points[i] = Voc * (2 - IV_Get_Sine(Phase_Act));
 			}
 		}
 	}
 	else { // linear voltage distribution
 		float Volt_Step_Size;
 		Voc = IV_Voc_Overshoot_Fact * Voc; // measure over VOC to get to get down to I=0
-		Volt_Step_Size = Voc / ((float)(IV_Meas_Points-1));
+		Volt_Step_Size = Voc / ((float)(Sweep_Points-1));
 		// calc points with linear distribution
-		for (i=0; i < IV_Meas_Points; i++) {
+		for (i=0; i < Sweep_Points; i++) {
 			PV_DAC_Points[i] = Volt_Step_Size * (float) (i);
 		}
 	}
+	// DAC counts of all points, so only the DAC needs to be written during the sweep
+	IV_MEAS__Calc_DAC_Counts(Sweep_Points);
+	// settling time constants are collected per region during the sweep
+	for (i=0; i < IV_DWELL_REGIONS; i++) IV_Dwell_Tau_ms[i] = -1.0;
+	// no power is delivered during the Voc & Isc range search
+	IV_Sweep_Tick_Last = Get_Timer_Main_Ticks();
+	
 	// set IV start point
-	if(is_IV_Mode__Reverse) Set_DAC_Output_Volts(PV_DAC_Points[(IV_Meas_Points-1)]);
+	if (is_IV_Mode__MPP_Split && !Seg_Sweep && !Ramp_Sweep) {
+		// first point at or above the old set-point (MPP)
+		Split_Point = 0;
+		while ((Split_Point < Sweep_Points) && (PV_DAC_Points[Split_Point] < DAC_Volt_Old)) Split_Point++;
+		Set_DAC_Output_Volts(DAC_Volt_Old);
+	}
+	else if(is_IV_Mode__Reverse) Set_DAC_Output_Volts(PV_DAC_Points[(Sweep_Points-1)]);
 	else Set_DAC_Output_Volts(PV_DAC_Points[0]);
 	// wait until settled
 	j = IV_Setup_Signal_Set_Time;
@@ -160,16 +285,263 @@ void PV_IV_MEAS(){
 		wdt_reset();
 	}
 	
-	// measure IV curve
-	for (i=0; i < IV_Meas_Points; i++) {
-		// set voltage
-		if(is_IV_Mode__Reverse) Set_DAC_Output_Volts(PV_DAC_Points[(IV_Meas_Points-i-1)]);
-		else Set_DAC_Output_Volts(PV_DAC_Points[i]);
+	// measure IV curve, stream points if requested (not the points of a pre-sweep)
+	IV_Stream_Sweep = is_COM_Status_IV_Stream_On;
+	if (Ramp_Sweep) {
+		IV_MEAS__Ramp_Sweep(Voc, Sweep_Points, is_IV_Mode__Reverse);
+	}
+	else if (Seg_Sweep) {
+		STOP_IV = IV_MEAS__Sweep_Segments(is_IV_Mode__Reverse);
+	}
+	else if (is_IV_Mode__MPP_Split) {
+		// points are sorted after the sweep, so they are streamed afterwards
+		IV_Stream_Sweep = false;
+		// sweep from MPP up to Voc
+		STOP_IV = IV_MEAS__Sweep_Points(Split_Point, Sweep_Points - Split_Point, 0, false, Volt_AVR_Mult, Curr_AVR_Mult);
+		// jump back to MPP, settle & sweep down to Isc
+		if (!STOP_IV && (Split_Point > 0)) {
+			Set_DAC_Output_Volts(DAC_Volt_Old);
+			j = IV_Setup_Signal_Set_Time;
+			wdt_reset();
+			while (j--){
+				_delay_ms(1);
+				wdt_reset();
+			}
+			STOP_IV = IV_MEAS__Sweep_Points(0, Split_Point, Sweep_Points - Split_Point, true, Volt_AVR_Mult, Curr_AVR_Mult);
+		}
+		// return to MPP straight away, before ranges are reset
+		Set_DAC_Output_Volts(DAC_Volt_Old);
+		IV_MEAS__Calc_Energy_Lost(Sweep_Power_Start, Sweep_Tick_Start);
+		Set_Point_Back = true;
+		// sort to rising voltage, the points below MPP are stored in falling voltage after the ones above
+		IV_MEAS__Reverse_Points(0, Sweep_Points);
+		IV_MEAS__Reverse_Points(Split_Point, Sweep_Points - Split_Point);
+	}
+	else {
+		STOP_IV = IV_MEAS__Sweep_Points(0, Sweep_Points, 0, is_IV_Mode__Reverse, Volt_AVR_Mult, Curr_AVR_Mult);
+	}
+	IV_Data_Points = Sweep_Points;
+	if (IV_Stream_Sweep) UART_Stream_IV(Sweep_Points);
+	// hysteresis sweep, measure straight back in opposite direction with same ranges and points
+	if (is_IV_Mode__Hyst_Sweep && !is_IV_Mode__MPP_Split && !Seg_Sweep && !Ramp_Sweep && !STOP_IV) {
+		STOP_IV = IV_MEAS__Sweep_Points(0, Sweep_Points, Sweep_Points, !is_IV_Mode__Reverse, Volt_AVR_Mult, Curr_AVR_Mult);
+		IV_Data_Points = 2 * Sweep_Points;
+		if (!STOP_IV) {
+			// reverse sweep is from Voc to 0V, hysteresis index = (Pmax_rev - Pmax_fwd) / Pmax_rev
+			float Pmax_Fwd, Pmax_Rev;
+			if (is_IV_Mode__Reverse) {
+				Pmax_Rev = get_Pmax_from_IV_Section(0, Sweep_Points);
+				Pmax_Fwd = get_Pmax_from_IV_Section(Sweep_Points, Sweep_Points);
+			}
+			else {
+				Pmax_Fwd = get_Pmax_from_IV_Section(0, Sweep_Points);
+				Pmax_Rev = get_Pmax_from_IV_Section(Sweep_Points, Sweep_Points);
+			}
+			if (Pmax_Rev > 0) IV_Hyst_Index = (Pmax_Rev - Pmax_Fwd) / Pmax_Rev;
+		}
+	}
+	// learn dwell times for the next sweep
+	if (IV_Dwell_Learn && !Ramp_Sweep && !STOP_IV) IV_MEAS__Dwell_Map_Update();
+	
+	// finish up now...
+	IV_Curve_Count++;
+	if (is_DI_Curr_Bypass_ON) SET__IV_Report_OverCurr_Bypass_Active; // check if clamp active
+	else CLR__IV_Report_OverCurr_Bypass_Active;
+	// only a completed sweep is a valid IV curve for the load modes
+	if (!STOP_IV) {
+		SET__IV_Data_Valid_Curve;
+		SET__Track_Status_new_IV_curve;
+	}
+	SET__Status_NewIvDataAvailable;
+	CLR__SysControl_IV_Meas;
+	// send rest of IV point stream & status
+	IV_Stream_Sweep = false;
+	if (is_COM_Status_IV_Stream_On) {
+		UART_Stream_IV_Finish();
+		CLR__Status_NewIvDataAvailable;
+	}
+	PV_Volt_DAQ_New = DAC_Volt_Old;		// reset voltage
+	// set old range and voltage again
+	if(Range_Curr_ID_Act != Curr_Range_Old) {
+		Range_Curr_Switch_Freq_Counter = 0;
+		SET_CURRENT_RANGE(Curr_Range_Old);
+	}
+	if(Range_Volt_ID_Act != Volt_Range_Old) {
+		Range_Volt_Switch_Freq_Counter = 0;
+		SET_VOLTAGE_RANGE(Volt_Range_Old);
+	}
+	Set_DAC_Output_Volts(PV_Volt_DAQ_New);
+	// energy lost compared to staying at the start point, until back at the start point
+	if (!Set_Point_Back) IV_MEAS__Calc_Energy_Lost(Sweep_Power_Start, Sweep_Tick_Start);
+	// time & energy of the measurement for the energy accumulators of the load control
+	IV_Block_Ticks = IV_Block_Ticks + (IV_Sweep_Tick_Last - Sweep_Tick_Start);
+	IV_Block_Power_Ticks = IV_Block_Power_Ticks + IV_Sweep_Power_Ticks;
+	Set_ADC_Mux_Voltage;
+	//settle last voltage
+	j = IV_Setup_Signal_Set_Time;
+	wdt_reset();
+	while (j--){
+		_delay_ms(1);
+		wdt_reset();
+	}
+	IV_Time_Actual_ms = (uint32_t) ((float) (Get_Timer_Main_Ticks() - Sweep_Tick_Start) * TIMER_1_TICK_TIME_S * 1000.0);
+	CLR__Status_MainTimerOverRun;
+	CLR__Timer_CTR_Main_Flag;
+	
+}
+
+//-------------------------------------------------------------------------------------------
+// Predict IV measurement time
+uint32_t IV_MEAS__Predict_Time_ms(){
+	/* function returns the expected duration of an IV measurement with the actual settings in [ms]
+	- IV_Setup_Signal_Set_Time must be up to date
+	- includes Voc & Isc range search, settling of start & end point, all points in the IV mode & expected range switching
+	- range switches are expected if the active range is not the range of the last IV measurement (and back at the end)
+	- with dynamic current ranging each enabled current range below the Isc range is expected once per sweep direction
+	- in segment mode the points are predicted with the delay & averaging of their segment
+	*/
+	uint8_t i, Sweep_Points, Nu_Sweeps, Nu_Range_Sets;
+	float Time_ms;
+	
+	if (IV_Ramp_Rate > 0) {
+		// continuous ramp, Voc of last Voc range search is the best guess of the ramp span
+		Sweep_Points = IV_Meas_Points;
+		Nu_Sweeps = 1;
+		Time_ms = 1000.0 * IV_Voc_Overshoot_Fact * IV_Voc_Last / IV_Ramp_Rate;
+		if (Time_ms > (1000.0 * IV_RAMP_MAX_TIME_S)) Time_ms = 1000.0 * IV_RAMP_MAX_TIME_S;
+		// settling at Voc, Isc, start point and end point
+		Time_ms = Time_ms + 4.0 * (float) IV_Setup_Signal_Set_Time;
+	}
+	else if (is_IV_Mode__Seg_Sweep && (IV_Seg_Count > 0) && (IV_Seg_Points[0] > 0)) {
+		// segment profile, points limited to IV buffer size as in IV_MEAS__Calc_Segment_Points
+		Sweep_Points = 0;
+		Nu_Sweeps = 1;
+		Time_ms = 0;
+		for (i=0; i < IV_Seg_Count; i++) {
+			if ((Sweep_Points + IV_Seg_Points[i]) > MAX_IV_POINTS) break;
+			Sweep_Points = Sweep_Points + IV_Seg_Points[i];
+			Time_ms = Time_ms + (float) IV_Seg_Points[i] * IV_MEAS__Predict_Point_Time_ms(IV_Seg_Delay_ms[i], IV_Seg_Nu_AVR_VoltCurr[i]);
+		}
+		// settling at Voc, Isc, start point and end point
+		Time_ms = Time_ms + 4.0 * (float) IV_Setup_Signal_Set_Time;
+	}
+	else {
+		// number of points & sweeps as measured in PV_IV_MEAS
+		Sweep_Points = IV_Meas_Points;
+		Nu_Sweeps = 1;
+		if (is_IV_Mode__Hyst_Sweep && !is_IV_Mode__MPP_Split) {
+			if (Sweep_Points > (MAX_IV_POINTS / 2)) Sweep_Points = MAX_IV_POINTS / 2;
+			Nu_Sweeps = 2;
+		}
+		Time_ms = IV_MEAS__Predict_Point_Time_ms(IV_Point_Set_Delay_ms, IV_Point_Meas_Nu_AVR_VoltCurr) * (float) Sweep_Points * (float) Nu_Sweeps;
+		
+		// settling at Voc, Isc, start point and end point, MPP split settles again at MPP
+		Time_ms = Time_ms + 4.0 * (float) IV_Setup_Signal_Set_Time;
+		if (is_IV_Mode__MPP_Split) Time_ms = Time_ms + (float) IV_Setup_Signal_Set_Time;
+		if (is_IV_Mode__Curr_Step) Time_ms = Time_ms + IV_MEAS__Predict_Point_Time_ms(IV_Point_Set_Delay_ms, IV_Point_Meas_Nu_AVR_VoltCurr) * (float) IV_CSTEP_PRE_POINTS;
+		else if (is_IV_Mode__Cos_Sweep) Time_ms = Time_ms + IV_Point_Cos_Calc_ms * (float) Sweep_Points;
+	}
+	
+	// range switching to IV ranges (with settling) & back at the end
+	if (!is_manual_Volt_Range_Set && (IV_Range_Volt_Last != Range_Volt_ID_Act)) {
+		Time_ms = Time_ms + 2.0 * (float) IV_Range_Set_Time_ms + (float) IV_Range_Set_Settle_Time_ms;
+	}
+	if (!is_manual_Curr_Range_Set && (IV_Range_Curr_Last != Range_Curr_ID_Act)) {
+		Time_ms = Time_ms + 2.0 * (float) IV_Range_Set_Time_ms + (float) IV_Range_Set_Settle_Time_ms;
+	}
+	// dynamic current ranging, each range switch measures the point again
+	if (is_IV_Mode__Dyn_Curr_Range && !is_manual_Curr_Range_Set && !(IV_Ramp_Rate > 0)) {
+		Nu_Range_Sets = 0;
+		for (i=0; i < IV_Range_Curr_Last; i++) {
+			if (Range_Curr_Enable & BIT(i)) Nu_Range_Sets++;
+		}
+		Time_ms = Time_ms + (float) (Nu_Range_Sets * Nu_Sweeps) * ((float) (IV_Range_Set_Time_ms + IV_Range_Set_Settle_Time_ms) + IV_MEAS__Predict_Point_Time_ms(0, IV_Point_Meas_Nu_AVR_VoltCurr));
+	}
+	
+	return (uint32_t) Time_ms;
+}
+
+//-------------------------------------------------------------------------------------------
+// Predict IV point measurement time
+float IV_MEAS__Predict_Point_Time_ms(uint16_t Delay_ms, uint8_t Nu_AVR_VoltCurr){
+	/* function returns the expected time to settle & measure one IV point in [ms] */
+	float Point_ms;
+	uint8_t Nu_Sets;
+	
+	// point settling loop, every 10ms two temperature measurements take a little longer
+	Point_ms = (float) Delay_ms + IV_Dwell_Temp_Extra_ms * (float) ((Delay_ms + 8) / 10 + (Delay_ms + 7) / 10);
+	// measurement sets of voltage & current, and asymmetric voltage measurement
+	// sequential averaging is predicted with the maximum number of sets, the measurement is done by then at the latest
+	Nu_Sets = IV_Point_Meas_Nu_AVR_Sets;
+	if (IV_Seq_SE_Target > 0) {
+		if (Nu_Sets < IV_SEQ_MIN_SETS) Nu_Sets = IV_SEQ_MIN_SETS;
+		if (Nu_Sets < IV_Seq_Max_Sets) Nu_Sets = IV_Seq_Max_Sets;
+	}
+	Point_ms = Point_ms + (float) Nu_Sets * (IV_Meas_Set_Time_ms + 2.0 * (float) Nu_AVR_VoltCurr * IV_Meas_Conv_Time_ms);
+	if (is_IV_Mode__Asym_Volt) Point_ms = Point_ms + 0.5 * IV_Meas_Set_Time_ms + (float) Nu_AVR_VoltCurr * IV_Meas_Conv_Time_ms;
+	
+	// DAC pre-emphasis overdrive before the dwell
+	Point_ms = Point_ms + 0.001 * (float) IV_MEAS__Get_Preemph_Time_us();
+	
+	return Point_ms + IV_Point_Overhead_ms;
+}
+
+//-------------------------------------------------------------------------------------------
+// Sweep through IV points
+bool IV_MEAS__Sweep_Points(uint8_t DAC_Start, uint8_t Nu_Points, uint8_t Data_Offset, bool Reverse, float Volt_AVR_Mult, float Curr_AVR_Mult){
+	/* function steps through the calculated DAC points from DAC start on and measures each IV point
+	- reverse steps from the last DAC point down to DAC start
+	- data is stored in measurement order, starting at data offset
+	- delivered energy is integrated for each point
+	- with dynamic current ranging the best range is selected after each point and the point is measured again if changed
+	- with dwell learning the dwell time is taken from the dwell map and the current is traced while settling
+	- IV report flags of each point are recorded as point quality flags, before they are added to the IV report
+	- streamed points are sent in an idle millisecond of the next point's dwell, the time taken counts to the dwell
+		- if the dwell is too short for an idle millisecond, they are sent after the point is measured
+	- returns true if stopped because of over temperature
+	*/
+	// need those variables
+	uint8_t i, k, New_Range, Report_Old, Flags;
+	uint8_t Region, Nu_Trace, Trace_Range;
+	uint16_t j, n, Dwell_ms;
+	uint32_t Stream_Start;
+	uint16_t Stream_us;
+	bool Streamed;
+	uint16_t Trace[IV_DWELL_TRACE_MAX];
+	uint16_t Trace_ms[IV_DWELL_TRACE_MAX];
+	uint16_t Preemph_us;
+	uint32_t Tick_Act;
+	float Final_Raw, Prev_Raw, Tau_ms;
+	bool STOP_IV, Prev_Valid;
+	STOP_IV = false;
+	Prev_Valid = false;
+	Prev_Raw = 0;
+	Preemph_us = IV_MEAS__Get_Preemph_Time_us();
+	
+	// measure IV points
+	for (i=0; i < Nu_Points; i++) {
+		// set voltage from pre-calculated DAC counts
+		if(Reverse) j = DAC_Start + Nu_Points - i - 1;
+		else j = DAC_Start + i;
+		if (Preemph_us) IV_MEAS__Set_DAC_Preemph(PV_DAC_Counts[j], PV_DAC_Points[j], Preemph_us);
+		else {
+			Set_DAC_Output_RAW(PV_DAC_Counts[j]);
+			PV_Volt_DAC_ACT = PV_DAC_Points[j];
+		}
+		Region = IV_MEAS__Get_Dwell_Region(PV_DAC_Points[j]);
 		// reset watchdog
 		wdt_reset();
+		// IV report of this point only
+		Report_Old = IV_Report;
+		IV_Report = 0;
+		Flags = 0;
 		// wait until settled
-		j = IV_Point_Set_Delay_ms;
+		Dwell_ms = IV_MEAS__Get_Dwell_ms(Region);
+		j = Dwell_ms;
 		k = 0;
+		Nu_Trace = 0;
+		Trace_Range = Range_Curr_ID_Act;
+		Streamed = !IV_Stream_Sweep;
 		while (j) {
 			// reset watchdog
 			wdt_reset();
@@ -192,6 +564,34 @@ void PV_IV_MEAS(){
 				meas_Bias_Volt_Range_Check();
 				_delay_us(655); // remaining time at 20 measurement averages
 			}
+			else if (IV_Dwell_Learn && (Nu_Trace < IV_DWELL_TRACE_MAX)) {
+				// record settle trace of current
+				Set_ADC_Mux_Current;
+				_delay_us(ADC_MUX_Set_Delay_us); // time it takes to set the channel and settle the signal at the ADC
+				Trace[Nu_Trace] = (uint16_t) (ADC_Convert_Avr_MAX11163(IV_DWELL_TRACE_AVR) / IV_DWELL_TRACE_AVR);
+				Trace_ms[Nu_Trace] = Dwell_ms - j;
+				Nu_Trace++;
+				_delay_us(999 - IV_Dwell_Trace_us);
+			}
+			else if (!Streamed && (k > 3)) {
+				// send measured points while this point settles, after the temperature & bias checks
+				Streamed = true;
+				Stream_Start = Get_Timer_1_Counts();
+				UART_Stream_IV(Data_Offset+i);
+				Stream_us = (uint16_t) ((float) (Get_Timer_1_Counts() - Stream_Start) * TIMER_1_COUNT_TIME_S * 1.0e6);
+				// whole milliseconds taken count down the dwell, the rest of this millisecond is delayed
+				while ((Stream_us >= 1000) && (j > 1)) {
+					Stream_us = Stream_us - 1000;
+					j--;
+				}
+				if (Stream_us < 999) {
+					n = (999 - Stream_us) / 10;
+					while (n) {
+						_delay_us(10);
+						n--;
+					}
+				}
+			}
 			else {
 				// do nothing delay
 				_delay_us(999);
@@ -206,42 +606,547 @@ void PV_IV_MEAS(){
 			
 		}
 		// break if over temperature
-		if (STOP_IV) break;
+		if (STOP_IV) {
+			IV_Report = IV_Report | Report_Old;
+			break;
+		}
 		// measure current and voltage
-		IV_MEAS__Meas_Curr_Volt_Point(Volt_AVR_Mult, Curr_AVR_Mult);
+		if (is_IV_Data_Seq_Stats) IV_MEAS__Meas_Curr_Volt_Point_Seq(Data_Offset+i);
+		else IV_MEAS__Meas_Curr_Volt_Point(Volt_AVR_Mult, Curr_AVR_Mult);
+		// dynamic current ranging, switch to best range for the measured current & measure point again
+		if (is_IV_Data_Curr_Range) {
+			New_Range = IV_MEAS__Get_Dyn_Curr_Range(is_IV_Report_Curr_Over_Load);
+			if (New_Range != Range_Curr_ID_Act) {
+				SET_CURRENT_RANGE(New_Range);
+				wdt_reset();
+				_delay_ms(IV_Range_Set_Settle_Time_ms); // wait until range signal settled
+				wdt_reset();
+				CLR__IV_Report_Curr_Over_Load;
+				CLR__IV_Report_Curr_Under_Load;
+				if (is_IV_Data_Seq_Stats) IV_MEAS__Meas_Curr_Volt_Point_Seq(Data_Offset+i);
+				else IV_MEAS__Meas_Curr_Volt_Point(Volt_AVR_Mult, Curr_AVR_Mult);
+				Flags = Flags | IV_Flag__Range_Change;
+			}
+		}
+		// fit settling time constant to trace, the step starts at the previous point & ends at this point
+		if (IV_Dwell_Learn) {
+			Final_Raw = AI_Curr / AI_Curr_Scale - AI_Curr_Offset;
+			if (Range_Curr_ID_Act == Trace_Range) {
+				if (Prev_Valid) Tau_ms = IV_MEAS__Dwell_Fit_Tau_ms(Trace, Trace_ms, Nu_Trace, Final_Raw, Prev_Raw - Final_Raw);
+				else Tau_ms = IV_MEAS__Dwell_Fit_Tau_ms(Trace, Trace_ms, Nu_Trace, Final_Raw, 0);
+				if (Tau_ms > IV_Dwell_Tau_ms[Region]) IV_Dwell_Tau_ms[Region] = Tau_ms;
+				// still moving at the last trace sample close to the end of the dwell
+				if (Nu_Trace > 0) {
+					if (((Trace_ms[Nu_Trace-1] + 2) >= Dwell_ms) && (fabs((float) Trace[Nu_Trace-1] - Final_Raw) > IV_DWELL_NOISE_COUNTS)) Flags = Flags | IV_Flag__Not_Settled;
+				}
+			}
+			Prev_Raw = Final_Raw;
+			Prev_Valid = true;
+		}
 		// transfer new data
-		PV_IV_Voltage[i] = AI_Volt;
-		PV_IV_Current[i] = AI_Curr_Corr;
+		PV_IV_Voltage[Data_Offset+i] = AI_Volt;
+		PV_IV_Current[Data_Offset+i] = AI_Curr_Corr;
+		PV_IV_Curr_Range[Data_Offset+i] = Range_Curr_ID_Act;
+		if (is_DI_Curr_Bypass_ON) Flags = Flags | IV_Flag__Bypass;
+		PV_IV_Flags[Data_Offset+i] = Flags | (IV_Report & IV_Flag__Report_Mask);
+		IV_Report = IV_Report | Report_Old;
+		// send measured points now if the dwell had no idle millisecond to send them in
+		if (!Streamed) UART_Stream_IV(Data_Offset+i+1);
+		// integrate delivered energy since last point
+		Tick_Act = Get_Timer_Main_Ticks();
+		IV_Sweep_Power_Ticks = IV_Sweep_Power_Ticks + AI_Volt * AI_Curr_Corr * (float) (Tick_Act - IV_Sweep_Tick_Last);
+		IV_Sweep_Tick_Last = Tick_Act;
 	}
 	
-	// finish up now...
-	if (is_DI_Curr_Bypass_ON) SET__IV_Report_OverCurr_Bypass_Active; // check if clamp active
-	else CLR__IV_Report_OverCurr_Bypass_Active;
-	SET__Track_Status_new_IV_curve;
-	SET__Status_NewIvDataAvailable;
-	CLR__SysControl_IV_Meas;
-	PV_Volt_DAQ_New = DAC_Volt_Old;		// reset voltage
-	// set old range and voltage again
-	if(Range_Curr_ID_Act != Curr_Range_Old) {
-		Range_Curr_Switch_Freq_Counter = 0;
-		SET_CURRENT_RANGE(Curr_Range_Old);
+	return STOP_IV;
+}
+
+//-------------------------------------------------------------------------------------------
+// Energy lost by the IV measurement
+void IV_MEAS__Calc_Energy_Lost(float Power_Start, uint32_t Tick_Start){
+	/* function calculates the energy lost compared to staying at the start point, called when the DAC is set back to it
+	- the time since the last IV point, including range restore, is counted at the power of the last point
+	- the settling at the start point afterwards is counted at the start power
+	*/
+	uint32_t Tick_Act;
+	
+	Tick_Act = Get_Timer_Main_Ticks();
+	IV_Sweep_Power_Ticks = IV_Sweep_Power_Ticks + AI_Volt * AI_Curr_Corr * (float) (Tick_Act - IV_Sweep_Tick_Last);
+	IV_Sweep_Tick_Last = Tick_Act;
+	IV_Sweep_Energy_Lost = (Power_Start * (float) (Tick_Act - Tick_Start) - IV_Sweep_Power_Ticks) * TIMER_1_TICK_TIME_S;
+}
+
+//-------------------------------------------------------------------------------------------
+// Reverse order of IV points
+void IV_MEAS__Reverse_Points(uint8_t Start, uint8_t Nu_Points){
+	/* function reverses the order of the IV points from start on in the IV data buffer, with all data recorded per point */
+	uint8_t i, j, Tmp_Byte;
+	uint16_t Tmp_Word;
+	float Tmp_Float;
+	
+	if (Nu_Points < 2) return;
+	i = Start;
+	j = Start + Nu_Points - 1;
+	while (i < j) {
+		Tmp_Float = PV_IV_Voltage[i];
+		PV_IV_Voltage[i] = PV_IV_Voltage[j];
+		PV_IV_Voltage[j] = Tmp_Float;
+		Tmp_Float = PV_IV_Current[i];
+		PV_IV_Current[i] = PV_IV_Current[j];
+		PV_IV_Current[j] = Tmp_Float;
+		Tmp_Byte = PV_IV_Curr_Range[i];
+		PV_IV_Curr_Range[i] = PV_IV_Curr_Range[j];
+		PV_IV_Curr_Range[j] = Tmp_Byte;
+		Tmp_Byte = PV_IV_Nu_Sets[i];
+		PV_IV_Nu_Sets[i] = PV_IV_Nu_Sets[j];
+		PV_IV_Nu_Sets[j] = Tmp_Byte;
+		Tmp_Word = PV_IV_Std_Err[i];
+		PV_IV_Std_Err[i] = PV_IV_Std_Err[j];
+		PV_IV_Std_Err[j] = Tmp_Word;
+		Tmp_Byte = PV_IV_Flags[i];
+		PV_IV_Flags[i] = PV_IV_Flags[j];
+		PV_IV_Flags[j] = Tmp_Byte;
+		i++;
+		j--;
 	}
-	if(Range_Volt_ID_Act != Volt_Range_Old) {
-		Range_Volt_Switch_Freq_Counter = 0;
-		SET_VOLTAGE_RANGE(Volt_Range_Old);
+}
+
+//-------------------------------------------------------------------------------------------
+// Dwell map region of voltage
+uint8_t IV_MEAS__Get_Dwell_Region(float Voltage){
+	/* function returns the dwell map region of the voltage, regions are equal fractions of Voc of the last Voc range search */
+	float Tmp_Float;
+	
+	if (IV_Voc_Last <= 0) return 0;
+	Tmp_Float = Voltage / IV_Voc_Last * (float) IV_DWELL_REGIONS;
+	if (Tmp_Float <= 0) return 0;
+	if (Tmp_Float >= (float) (IV_DWELL_REGIONS - 1)) return IV_DWELL_REGIONS - 1;
+	return (uint8_t) Tmp_Float;
+}
+
+//-------------------------------------------------------------------------------------------
+// Dwell time of region
+uint16_t IV_MEAS__Get_Dwell_ms(uint8_t Region){
+	/* function returns the dwell time of an IV point in the region
+	- learned dwell time if learning is on & the region was learned, otherwise the IV point delay
+	- the IV point delay is the upper limit
+	*/
+	if (!IV_Dwell_Learn || (IV_Dwell_Map_ms[Region] == 0)) return IV_Point_Set_Delay_ms;
+	if (IV_Dwell_Map_ms[Region] > IV_Point_Set_Delay_ms) return IV_Point_Set_Delay_ms;
+	return IV_Dwell_Map_ms[Region];
+}
+
+//-------------------------------------------------------------------------------------------
+// Fit settling time constant to settle trace
+float IV_MEAS__Dwell_Fit_Tau_ms(uint16_t *Trace, uint16_t *Trace_ms, uint8_t Nu_Trace, float Final, float Step){
+	/* function estimates the settling time constant in [ms] of a first order step response from the settle trace
+	- deviation from the final value decays as exp(-t/tau), with the step as deviation at t = 0 if known (not 0)
+	- tau is taken from the first deviation above noise & the last one before the trace is within noise
+	- once within noise the noise level is used as last deviation, so tau is an upper limit
+	- returns negative if the trace does not show a decay
+	*/
+	uint8_t i;
+	float T_First, D_First, T_Last, D_Last, Dev;
+	
+	// first deviation, step or first trace sample
+	i = 0;
+	if (fabs(Step) > IV_DWELL_NOISE_COUNTS) {
+		T_First = 0;
+		D_First = fabs(Step);
 	}
-	Set_DAC_Output_Volts(PV_Volt_DAQ_New);
-	Set_ADC_Mux_Voltage;
-	//settle last voltage
-	j = IV_Setup_Signal_Set_Time;
-	wdt_reset();
-	while (j--){
-		_delay_ms(1);
-		wdt_reset();
+	else {
+		if (Nu_Trace == 0) return -1.0;
+		T_First = (float) Trace_ms[0] + IV_DWELL_TRACE_T0_MS;
+		D_First = fabs((float) Trace[0] - Final);
+		if (D_First <= IV_DWELL_NOISE_COUNTS) return -1.0;
+		i = 1;
 	}
-	CLR__Status_MainTimerOverRun;
-	CLR__Timer_CTR_Main_Flag;
+	// last deviation above noise, or first one within noise
+	T_Last = T_First;
+	D_Last = D_First;
+	while (i < Nu_Trace) {
+		Dev = fabs((float) Trace[i] - Final);
+		T_Last = (float) Trace_ms[i] + IV_DWELL_TRACE_T0_MS;
+		if (Dev <= IV_DWELL_NOISE_COUNTS) {
+			D_Last = IV_DWELL_NOISE_COUNTS;
+			break;
+		}
+		D_Last = Dev;
+		i++;
+	}
+	if ((T_Last <= T_First) || (D_Last >= D_First)) return -1.0;
+	
+	return (T_Last - T_First) / log(D_First / D_Last);
+}
+
+//-------------------------------------------------------------------------------------------
+// Reset learned dwell map
+void IV_MEAS__Dwell_Map_Reset(){
+	/* function clears the learned dwell map, so the IV point delay is used until learned again */
+	uint8_t i;
+	for (i=0; i < IV_DWELL_REGIONS; i++) IV_Dwell_Map_ms[i] = 0;
+}
+
+//-------------------------------------------------------------------------------------------
+// Update learned dwell map
+void IV_MEAS__Dwell_Map_Update(){
+	/* function updates the dwell map from the largest settling time constant per region of the last sweep
+	- dwell time is the time constant multiple, at least IV_DWELL_MIN_MS so the over temperature & bias checks still run
+	- regions without information keep their dwell time
+	*/
+	uint8_t i;
+	float Tmp_Float;
+	for (i=0; i < IV_DWELL_REGIONS; i++) {
+		if (IV_Dwell_Tau_ms[i] < 0) continue;
+		Tmp_Float = ceil(IV_Dwell_Tau_ms[i] * IV_Dwell_Tau_Mult);
+		if (Tmp_Float < IV_DWELL_MIN_MS) Tmp_Float = IV_DWELL_MIN_MS;
+		else if (Tmp_Float > 60000.0) Tmp_Float = 60000.0;
+		IV_Dwell_Map_ms[i] = (uint16_t) Tmp_Float;
+	}
+}
+
+//-------------------------------------------------------------------------------------------
+// DAC overdrive time
+uint16_t IV_MEAS__Get_Preemph_Time_us(){
+	/* function returns the DAC overdrive time in [us] of the pre-emphasis, 0 if off
+	- a first order response driven with (1 + gain) times the step reaches the step after tau * ln((1 + gain) / gain)
+	*/
+	float Tmp_Float;
+	
+	if ((IV_Preemph_Gain <= 0) || (IV_Preemph_Tau_us <= 0)) return 0;
+	Tmp_Float = IV_Preemph_Tau_us * log((1.0 + IV_Preemph_Gain) / IV_Preemph_Gain);
+	if (Tmp_Float > IV_PREEMPH_MAX_US) return IV_PREEMPH_MAX_US;
+	if (Tmp_Float < 10.0) return 10;
+	return (uint16_t) Tmp_Float;
+}
+
+//-------------------------------------------------------------------------------------------
+// Set DAC with overdrive pre-emphasis
+void IV_MEAS__Set_DAC_Preemph(uint16_t DAC_Counts, float Voltage, uint16_t Time_us){
+	/* function overdrives the DAC past the new voltage by the pre-emphasis gain times the step for the overdrive time
+	- then lands on the DAC counts of the new voltage
+	- overdrive is limited to the DAC range, which makes it less effective close to 0V & the range end
+	*/
+	uint16_t n;
+	
+	Set_DAC_Output_RAW(Get_DAC_Counts_From_Volts(Voltage + IV_Preemph_Gain * (Voltage - PV_Volt_DAC_ACT)));
+	n = Time_us / 10;
+	while (n) {
+		_delay_us(10);
+		n--;
+	}
+	Set_DAC_Output_RAW(DAC_Counts);
+	PV_Volt_DAC_ACT = Voltage;
+}
+
+//-------------------------------------------------------------------------------------------
+// Calculate DAC counts of IV points
+void IV_MEAS__Calc_DAC_Counts(uint8_t Nu_Points){
+	/* function converts the IV point voltages to DAC counts before the sweep, with the actual voltage range calibration
+	- keeps the float division & calibration out of the timed point loop
+	- voltage range must not change until the sweep is done
+	*/
+	uint8_t i;
+	for (i=0; i < Nu_Points; i++) {
+		PV_DAC_Counts[i] = Get_DAC_Counts_From_Volts(PV_DAC_Points[i]);
+	}
+}
+
+//-------------------------------------------------------------------------------------------
+// Sine from table
+float IV_Get_Sine(float Phase){
+	/* function returns sin(Phase) from the quarter wave table with linear interpolation, faster than the soft float sin()
+	- phase in radians, any phase is folded into the first quarter
+	*/
+	uint8_t Index;
+	float Index_Float, Fraction, Sign, Val_Low, Val_High;
+	
+	// fold phase into 0 ... pi/2
+	while (Phase < 0) Phase = Phase + 4.0 * IV_PI_HALF;
+	while (Phase > (4.0 * IV_PI_HALF)) Phase = Phase - 4.0 * IV_PI_HALF;
+	Sign = 1.0;
+	if (Phase > (2.0 * IV_PI_HALF)) {
+		Phase = Phase - 2.0 * IV_PI_HALF;
+		Sign = -1.0;
+	}
+	if (Phase > IV_PI_HALF) Phase = 2.0 * IV_PI_HALF - Phase;
 	
+	// interpolate table
+	Index_Float = Phase * ((float) IV_SINE_TABLE_SIZE / IV_PI_HALF);
+	Index = (uint8_t) Index_Float;
+	if (Index >= IV_SINE_TABLE_SIZE) return Sign;
+	Fraction = Index_Float - (float) Index;
+	Val_Low = (float) pgm_read_word(&IV_SINE_QUARTER[Index]);
+	Val_High = (float) pgm_read_word(&IV_SINE_QUARTER[Index + 1]);
+	
+	return Sign * (Val_Low + (Val_High - Val_Low) * Fraction) * (1.0 / 65535.0);
+}
+
+//-------------------------------------------------------------------------------------------
+// Calculate averaging multipliers
+void IV_MEAS__Calc_AVR_Mult(float *Volt_AVR_Mult, float *Curr_AVR_Mult){
+	/* function calculates the multipliers to average the summed voltage & current conversions of an IV point
+	- uses the actual number of averages per set & number of sets
+	*/
+	if (is_IV_Mode__Asym_Volt) {
+		*Volt_AVR_Mult = 1.0 / ((float) (IV_Point_Meas_Nu_AVR_VoltCurr) * ((float) (IV_Point_Meas_Nu_AVR_Sets) + 1.0));
+		*Curr_AVR_Mult = 1.0 / ((float) (IV_Point_Meas_Nu_AVR_VoltCurr) * (float) (IV_Point_Meas_Nu_AVR_Sets));
+	}
+	else {
+		*Volt_AVR_Mult = 1.0 / ((float) (IV_Point_Meas_Nu_AVR_VoltCurr) * (float) (IV_Point_Meas_Nu_AVR_Sets));
+		*Curr_AVR_Mult = *Volt_AVR_Mult;
+	}
+}
+
+//-------------------------------------------------------------------------------------------
+// Calculate segment profile voltage points
+uint8_t IV_MEAS__Calc_Segment_Points(float Voc){
+	/* function calculates the DAC voltage points of the IV sweep profile segments and returns the number of points
+	- each segment spans from the end of the previous segment (0V for the first) to its end fraction of Voc
+	- points are linear within a segment, the first segment includes 0V, the others exclude their start voltage
+	- segments that don't fit into the IV buffer anymore are ignored
+	*/
+	uint8_t i, j, Nu_Points;
+	float Volt_Start, Volt_End, Volt_Step_Size;
+	
+	Nu_Points = 0;
+	Volt_Start = 0;
+	for (i=0; i < IV_Seg_Count; i++) {
+		if ((Nu_Points + IV_Seg_Points[i]) > MAX_IV_POINTS) break;
+		Volt_End = IV_Seg_End_Voc_Fact[i] * Voc;
+		if (Volt_End < Volt_Start) Volt_End = Volt_Start;
+		for (j=0; j < IV_Seg_Points[i]; j++) {
+			if (i == 0) {
+				if (IV_Seg_Points[i] > 1) Volt_Step_Size = Volt_End / (float) (IV_Seg_Points[i] - 1);
+				else Volt_Step_Size = 0;
+				PV_DAC_Points[Nu_Points] = Volt_Step_Size * (float) j;
+			}
+			else {
+				Volt_Step_Size = (Volt_End - Volt_Start) / (float) IV_Seg_Points[i];
+				PV_DAC_Points[Nu_Points] = Volt_Start + Volt_Step_Size * (float) (j + 1);
+			}
+			Nu_Points++;
+		}
+		Volt_Start = Volt_End;
+	}
+	
+	return Nu_Points;
+}
+
+//-------------------------------------------------------------------------------------------
+// Calculate current stepped voltage points
+void IV_MEAS__Calc_Curr_Step_Points(float Volt_End, uint8_t Nu_Points, float Volt_AVR_Mult, float Curr_AVR_Mult){
+	/* function calculates DAC voltage points resulting in equally spaced current points from Isc to the end voltage
+	- measures a coarse linear pre-sweep from 0V to the end voltage first, data is overwritten by the IV measurement
+	- the voltage of each current step is interpolated between the two pre-sweep points around it
+	- points are kept in rising order, so noise in the pre-sweep can't reverse the voltage direction
+	- an over temperature stop is not handled here, the IV measurement stops at its first point
+	*/
+	uint8_t j, k;
+	float Volt_Step_Size, Curr_Start, Curr_End, Curr_Target, Curr_Diff, Fraction;
+	
+	// coarse linear pre-sweep
+	Volt_Step_Size = Volt_End / (float) (IV_CSTEP_PRE_POINTS - 1);
+	for (j=0; j < IV_CSTEP_PRE_POINTS; j++) {
+		PV_DAC_Points[j] = Volt_Step_Size * (float) j;
+	}
+	IV_MEAS__Calc_DAC_Counts(IV_CSTEP_PRE_POINTS);
+	IV_Sweep_Tick_Last = Get_Timer_Main_Ticks();
+	IV_MEAS__Sweep_Points(0, IV_CSTEP_PRE_POINTS, 0, false, Volt_AVR_Mult, Curr_AVR_Mult);
+	
+	// equal current steps from Isc (first point) to current at the end voltage
+	Curr_Start = PV_IV_Current[0];
+	Curr_End = PV_IV_Current[IV_CSTEP_PRE_POINTS-1];
+	j = 0;
+	for (k=0; k < Nu_Points; k++) {
+		Curr_Target = Curr_Start + (Curr_End - Curr_Start) * (float) k / (float) (Nu_Points - 1);
+		// find pre-sweep points around the target current
+		while ((j < (IV_CSTEP_PRE_POINTS - 2)) && (PV_IV_Current[j+1] > Curr_Target)) j++;
+		// interpolate voltage
+		Curr_Diff = PV_IV_Current[j] - PV_IV_Current[j+1];
+		if (Curr_Diff > 0) Fraction = (PV_IV_Current[j] - Curr_Target) / Curr_Diff;
+		else Fraction = 1.0;
+		if (Fraction < 0) Fraction = 0;
+		else if (Fraction > 1.0) Fraction = 1.0;
+		// pre-sweep DAC points are overwritten by now, but they are linear
+		PV_DAC_Points[k] = Volt_Step_Size * ((float) j + Fraction);
+		if ((k > 0) && (PV_DAC_Points[k] < PV_DAC_Points[k-1])) PV_DAC_Points[k] = PV_DAC_Points[k-1];
+	}
+}
+
+//-------------------------------------------------------------------------------------------
+// Continuous ramp IV measurement
+void IV_MEAS__Ramp_Sweep(float Volt_End, uint8_t Nu_Points, bool Reverse){
+	/* function ramps the DAC continuously from 0V to the end voltage (or reverse) with the configured slew rate
+	- voltage & current are sampled alternately at equal time intervals over the ramp, the DAC is updated in between
+	- every sample is time stamped with the main timer counter, the voltage is interpolated to the time of the current sample
+	to correct the skew between both, the last point uses an extra voltage sample
+	- range is not changed and temperatures are not checked during the ramp, the ramp time is limited instead
+	*/
+	uint8_t i;
+	uint16_t DAC_Counts;
+	uint32_t Time_Start, Time_Act, Time_Ramp, Time_Volt, Time_Curr, Time_Volt_Last, Time_Curr_Last, Tick_Start;
+	float DAC_Start, DAC_End, Ramp_Time_s, Temp_Float, Volt_Last, Power_Sum;
+	
+	// DAC counts at start & end
+	DAC_Start = (float) Get_DAC_Counts_From_Volts(0);
+	DAC_End = (float) Get_DAC_Counts_From_Volts(Volt_End);
+	if (Reverse) {
+		Temp_Float = DAC_Start;
+		DAC_Start = DAC_End;
+		DAC_End = Temp_Float;
+	}
+	// ramp time in timer counts
+	Ramp_Time_s = Volt_End / IV_Ramp_Rate;
+	if (Ramp_Time_s > IV_RAMP_MAX_TIME_S) Ramp_Time_s = IV_RAMP_MAX_TIME_S;
+	Time_Ramp = (uint32_t) (Ramp_Time_s / TIMER_1_COUNT_TIME_S);
+	if (Time_Ramp < 1) Time_Ramp = 1;
+	
+	Volt_Last = 0;
+	Time_Volt_Last = 0;
+	Time_Curr_Last = 0;
+	Power_Sum = 0;
+	Tick_Start = Get_Timer_Main_Ticks();
+	Time_Start = Get_Timer_1_Counts();
+	for (i=0; i <= Nu_Points; i++) {
+		// ramp DAC until next sample time
+		do {
+			wdt_reset();
+			Time_Act = Get_Timer_1_Counts() - Time_Start;
+			if (Time_Act > Time_Ramp) Temp_Float = DAC_End;
+			else Temp_Float = DAC_Start + (DAC_End - DAC_Start) * (float) Time_Act / (float) Time_Ramp;
+			DAC_Counts = (uint16_t) Temp_Float;
+			Set_DAC_Output_RAW(DAC_Counts);
+		} while ((i < Nu_Points) && ((float) Time_Act < (float) Time_Ramp * (float) i / (float) (Nu_Points - 1)));
+		
+		// measure voltage
+		Set_ADC_Mux_Voltage;
+		_delay_us(ADC_MUX_Set_Delay_us);
+		Temp_Float = (float) ADC_Convert_Avr_OLUL_MAX11163(IV_RAMP_NU_AVR) * (1.0 / IV_RAMP_NU_AVR);
+		Time_Volt = Get_Timer_1_Counts() - Time_Start;
+		if (AI_Under_Load) SET__IV_Report_Volt_Under_Load;
+		else if (AI_Over_Load) SET__IV_Report_Volt_Over_Load;
+		AI_Volt = (Temp_Float + AI_Volt_Offset) * AI_Volt_Scale;
+		
+		// voltage of last point at time of its current sample
+		if (i > 0) {
+			if (Time_Volt > Time_Volt_Last) {
+				PV_IV_Voltage[i-1] = Volt_Last + (AI_Volt - Volt_Last) * (float) (Time_Curr_Last - Time_Volt_Last) / (float) (Time_Volt - Time_Volt_Last);
+			}
+			PV_IV_Current[i-1] = PV_IV_Current[i-1] + PV_IV_Voltage[i-1] * AI_Volt_R_Leak;
+			PV_IV_Curr_Range[i-1] = Range_Curr_ID_Act;
+			Power_Sum = Power_Sum + PV_IV_Voltage[i-1] * PV_IV_Current[i-1];
+		}
+		// last voltage sample is only for the skew correction
+		if (i == Nu_Points) break;
+		PV_IV_Voltage[i] = AI_Volt;
+		Volt_Last = AI_Volt;
+		Time_Volt_Last = Time_Volt;
+		
+		// update DAC and measure current
+		Time_Act = Get_Timer_1_Counts() - Time_Start;
+		if (Time_Act > Time_Ramp) Temp_Float = DAC_End;
+		else Temp_Float = DAC_Start + (DAC_End - DAC_Start) * (float) Time_Act / (float) Time_Ramp;
+		DAC_Counts = (uint16_t) Temp_Float;
+		Set_DAC_Output_RAW(DAC_Counts);
+		Set_ADC_Mux_Current;
+		_delay_us(ADC_MUX_Set_Delay_us);
+		Temp_Float = (float) ADC_Convert_Avr_OLUL_MAX11163(IV_RAMP_NU_AVR) * (1.0 / IV_RAMP_NU_AVR);
+		Time_Curr_Last = Get_Timer_1_Counts() - Time_Start;
+		if (AI_Under_Load) SET__IV_Report_Curr_Under_Load;
+		else if (AI_Over_Load) SET__IV_Report_Curr_Over_Load;
+		AI_Curr = (Temp_Float + AI_Curr_Offset) * AI_Curr_Scale;
+		PV_IV_Current[i] = AI_Curr; // leakage corrected with the interpolated voltage
+	}
+	// DAC volts at end of ramp
+	if (Reverse) PV_Volt_DAC_ACT = 0;
+	else PV_Volt_DAC_ACT = Volt_End;
+	
+	// integrate delivered energy with the average power of the ramp
+	IV_Sweep_Tick_Last = Get_Timer_Main_Ticks();
+	IV_Sweep_Power_Ticks = IV_Sweep_Power_Ticks + Power_Sum / (float) Nu_Points * (float) (IV_Sweep_Tick_Last - Tick_Start);
+}
+
+//-------------------------------------------------------------------------------------------
+// Sweep through IV profile segments
+bool IV_MEAS__Sweep_Segments(bool Reverse){
+	/* function measures the IV points calculated by IV_MEAS__Calc_Segment_Points segment by segment
+	- point delay & number of averages are set for each segment and restored at the end
+	- reverse starts with the last segment
+	- returns true if stopped because of over temperature
+	*/
+	uint8_t i, Seg, Nu_Seg, DAC_Start, Data_Offset;
+	uint8_t Seg_DAC_Start[IV_SEG_MAX];
+	uint16_t Delay_Old;
+	uint8_t AVR_Old;
+	float Volt_AVR_Mult, Curr_AVR_Mult;
+	bool STOP_IV;
+	STOP_IV = false;
+	
+	// get segments fitting into the IV buffer & their first point
+	Nu_Seg = 0;
+	DAC_Start = 0;
+	for (i=0; i < IV_Seg_Count; i++) {
+		if ((DAC_Start + IV_Seg_Points[i]) > MAX_IV_POINTS) break;
+		Seg_DAC_Start[i] = DAC_Start;
+		DAC_Start = DAC_Start + IV_Seg_Points[i];
+		Nu_Seg++;
+	}
+	
+	// measure segments
+	Delay_Old = IV_Point_Set_Delay_ms;
+	AVR_Old = IV_Point_Meas_Nu_AVR_VoltCurr;
+	Data_Offset = 0;
+	for (i=0; i < Nu_Seg; i++) {
+		if (Reverse) Seg = Nu_Seg - i - 1;
+		else Seg = i;
+		IV_Point_Set_Delay_ms = IV_Seg_Delay_ms[Seg];
+		IV_Point_Meas_Nu_AVR_VoltCurr = IV_Seg_Nu_AVR_VoltCurr[Seg];
+		IV_MEAS__Calc_AVR_Mult(&Volt_AVR_Mult, &Curr_AVR_Mult);
+		STOP_IV = IV_MEAS__Sweep_Points(Seg_DAC_Start[Seg], IV_Seg_Points[Seg], Data_Offset, Reverse, Volt_AVR_Mult, Curr_AVR_Mult);
+		Data_Offset = Data_Offset + IV_Seg_Points[Seg];
+		if (STOP_IV) break;
+	}
+	IV_Point_Set_Delay_ms = Delay_Old;
+	IV_Point_Meas_Nu_AVR_VoltCurr = AVR_Old;
+	
+	return STOP_IV;
+}
+
+//-------------------------------------------------------------------------------------------
+// Reset IV measurement schedule
+void IV_Schedule_Reset(){
+	/* function sets the time of the next scheduled IV measurement one interval from now
+	- the start is delayed by the stagger time for each com address, so devices on the same bus don't sweep together
+	*/
+	float Delay_s;
+	Delay_s = (float) IV_Sched_Interval_s + (float) IV_Sched_Stagger_s * (float) (Com_ID - UART_ASCII_ADR_OFFSET);
+	IV_Sched_Tick_Next = Get_Timer_Main_Ticks() + (uint32_t) (Delay_s / TIMER_1_TICK_TIME_S);
+}
+
+//-------------------------------------------------------------------------------------------
+// Process IV measurement schedule
+void IV_Schedule_Process(){
+	/* function starts a scheduled IV measurement when due, called every control cycle while the output is on
+	- the measurement is delayed while an IV data transfer or another measurement is active
+	- if an error is active the scheduled measurement is skipped
+	- the schedule keeps its cadence, unless it has fallen behind by more than an interval
+	*/
+	uint32_t Tick_Act, Interval_Ticks;
+	
+	if (IV_Sched_Interval_s > 0) {
+		Tick_Act = Get_Timer_Main_Ticks();
+		// check if due, difference is signed to work over timer tick overflow
+		if ((int32_t) (Tick_Act - IV_Sched_Tick_Next) >= 0) {
+			if (!is_COM_Status_IV_Data_Transfer_On && !is_SysControl_IV_Meas && !is_SysControl_Trans_Meas) {
+				if (!(Check_Temp_Disconnect_State() || is_Status_Bias_Error)) SET__SysControl_IV_Meas;
+				// set next measurement time
+				Interval_Ticks = (uint32_t) ((float) IV_Sched_Interval_s / TIMER_1_TICK_TIME_S);
+				IV_Sched_Tick_Next = IV_Sched_Tick_Next + Interval_Ticks;
+				if ((int32_t) (Tick_Act - IV_Sched_Tick_Next) >= 0) IV_Sched_Tick_Next = Tick_Act + Interval_Ticks;
+			}
+		}
+	}
 }
 
 //-------------------------------------------------------------------------------------------
@@ -256,6 +1161,7 @@ void PV_TRANS_MEAS(){
 	uint16_t n, j;
 	uint8_t Act_IV_Point;
 	uint16_t Delay_nu_nops;
+	uint16_t Preemph_us = IV_MEAS__Get_Preemph_Time_us();
 	uint8_t Volt_Range_Old = Range_Volt_ID_Act;
 	uint8_t Curr_Range_Old = Range_Curr_ID_Act;
 	float PV_Volt_DAC_Old = PV_Volt_DAC_ACT;
@@ -300,7 +1206,8 @@ void PV_TRANS_MEAS(){
 	i = IV_Meas_Points;
 	Act_IV_Point = 0;
 	// set step voltage
-	Set_DAC_Output_Volts(PV_Volt_Trs);
+	if (Preemph_us) IV_MEAS__Set_DAC_Preemph(Get_DAC_Counts_From_Volts(PV_Volt_Trs), PV_Volt_Trs, Preemph_us);
+	else Set_DAC_Output_Volts(PV_Volt_Trs);
 	// measure voltage transient
 	while(i) {
 		Temp_Data[Act_IV_Point] = ADC_Convert_MAX11163();	// measure Voltage channel
@@ -333,7 +1240,8 @@ void PV_TRANS_MEAS(){
 	i = IV_Meas_Points;
 	Act_IV_Point = 0;
 	// set step voltage
-	Set_DAC_Output_Volts(PV_Volt_Trs);
+	if (Preemph_us) IV_MEAS__Set_DAC_Preemph(Get_DAC_Counts_From_Volts(PV_Volt_Trs), PV_Volt_Trs, Preemph_us);
+	else Set_DAC_Output_Volts(PV_Volt_Trs);
 	// measure current transient
 	while(i) {
 		Temp_Data[Act_IV_Point] = ADC_Convert_MAX11163();	// measure Current channel
@@ -353,7 +1261,12 @@ void PV_TRANS_MEAS(){
 		PV_IV_Current[i] = (float) Temp_Data[i]; // - AI_Curr_Offset) * AI_Curr_Scale;
 	}
 		
+	// learn time constant of the voltage step response for the DAC pre-emphasis
+	if (!Preemph_us) TRANS_MEAS__Learn_Preemph_Tau();
+	
 	// transient measurement finished, reset old conditions
+	IV_Data_Points = IV_Meas_Points;
+	IV_Data_Content = 0;		// ADC counts, also no valid IV curve for the load modes
 	CLR__SysControl_Trans_Meas;
 	SET__Status_NewIvDataAvailable;
 	Set_DAC_Output_Volts(PV_Volt_DAC_ACT); // set back to last output voltage
@@ -379,6 +1292,37 @@ void PV_TRANS_MEAS(){
 
 }
 
+//-------------------------------------------------------------------------------------------
+// Learn DAC pre-emphasis time constant from voltage transient
+void TRANS_MEAS__Learn_Preemph_Tau(){
+	/* function estimates the first order time constant of the voltage step response in the transient buffer
+	- voltage is in ADC counts, the first point is the start & the average of the last eighth of the points is the end
+	- time constant is the time the voltage takes to 63.2% of the step, interpolated between points
+	- pre-emphasis time constant is not changed if the step is too small or the voltage does not get there
+	*/
+	uint8_t i, Nu_End;
+	float V_Start, V_End, V_Tau, Frac;
+	
+	// start & end value
+	V_Start = PV_IV_Voltage[0];
+	Nu_End = IV_Meas_Points / 8;
+	if (Nu_End == 0) Nu_End = 1;
+	V_End = 0;
+	for (i = IV_Meas_Points - Nu_End; i < IV_Meas_Points; i++) V_End = V_End + PV_IV_Voltage[i];
+	V_End = V_End / (float) Nu_End;
+	if (fabs(V_End - V_Start) < IV_PREEMPH_MIN_STEP_COUNTS) return;
+	
+	// find first point beyond 63.2% of the step
+	V_Tau = V_Start + 0.632 * (V_End - V_Start);
+	for (i=1; i < IV_Meas_Points; i++) {
+		if (((V_End > V_Start) && (PV_IV_Voltage[i] >= V_Tau)) || ((V_End < V_Start) && (PV_IV_Voltage[i] <= V_Tau))) {
+			Frac = (V_Tau - PV_IV_Voltage[i-1]) / (PV_IV_Voltage[i] - PV_IV_Voltage[i-1]);
+			IV_Preemph_Tau_us = ((float) (i - 1) + Frac) * Trs_Delay_us;
+			return;
+		}
+	}
+}
+
 
 //-------------------------------------------------------------------------------------------
 // Get to Voc & set optimum range 
@@ -430,6 +1374,55 @@ float IV_MEAS__Get_Voc_Set_Optimum_Range() {
 		}
 		else { break; }
 	}
+	IV_Voc_Last = AI_Volt;
+	return AI_Volt;
+
+}
+
+//-------------------------------------------------------------------------------------------
+// Get VOC fast in the active range
+float IV_MEAS__Get_Voc_Fast(uint8_t Settle_ms) {
+	/* function returns VOC, the measured voltage after a short settle time at full scale DAC
+	- the load is open only for a few milliseconds, PV_Volt_DAQ_New is not changed, the load control sets the DAC back to it
+	- starts in the last VOC range if larger than active, the auto range switches back down at the operating point
+	- if the voltage is over range the range is increased, with the same settle time per range, not in manual mode
+		- the new range is kept as last VOC range, so the next samples start in it
+	- the time is counted as blocked without power delivered for the energy accumulators
+	*/
+	uint8_t i, j;
+	uint8_t OLD_Range;
+	uint32_t Tick_Start;
+	
+	Tick_Start = Get_Timer_Main_Ticks();
+	if (!is_manual_Volt_Range_Set) {
+		if (IV_Range_Volt_Last > Range_Volt_ID_Act){
+			SET_VOLTAGE_RANGE(IV_Range_Volt_Last);
+		}
+	}
+	Set_DAC_Output_Volts(Threshold_Volt_Over_Range[Volt_range_max_ID]);	// DAC to max voltage to get a VOC measurement
+	
+	i = Volt_range_max_ID+1; // maximum rounds
+	while (i--){
+		// wait until settled
+		j = Settle_ms;
+		wdt_reset();
+		while (j--){
+			_delay_ms(1);
+			wdt_reset();
+		}
+		Meas_AI_Volt_Only();
+		if (!AI_Over_Load || is_manual_Volt_Range_Set) break;
+		// over range, next range up
+		OLD_Range = Range_Volt_ID_Act;
+		Range_Volt_Switch_Freq_Counter = 0;	// reset switching frequency limiter
+		Range_Volt_Switch_Delay_Counter = 0; // remove switching delay
+		Process_Voltage_Auto_Range();
+		if (OLD_Range == Range_Volt_ID_Act) break; // no range above
+		IV_Range_Volt_Last = Range_Volt_ID_Act;
+	}
+	IV_Block_Ticks = IV_Block_Ticks + (Get_Timer_Main_Ticks() - Tick_Start);
+	CLR__Status_MainTimerOverRun;
+	CLR__Timer_CTR_Main_Flag;
 	return AI_Volt;
 
 }
@@ -494,6 +1487,34 @@ void IV_MEAS__Get_Curr_Optimum_Range() {
 	
 }
 
+//-------------------------------------------------------------------------------------------
+// Get best current range for last IV point
+uint8_t IV_MEAS__Get_Dyn_Curr_Range(bool Curr_Over_Load){
+	/* function returns the best current range for the last measured IV point during dynamic current ranging
+	- same rules as the auto range, but without switching delay and hold up as the sweep moves on every point
+	- goes up two ranges at a time on over load or active over current bypass, and resets the clamp
+	*/
+	uint8_t New_Range;
+	New_Range = Range_Curr_ID_Act;
+	
+	if (Curr_Over_Load || is_DI_Curr_Bypass_ON) {
+		// range too low, go up
+		if ((New_Range + 2) <= Curr_range_max_ID) New_Range = New_Range + 2;
+		else New_Range = New_Range + 1;
+		// reset over range state
+		if (is_DI_Curr_Bypass_ON) Reset_Over_Current_Clamp();
+	}
+	else {
+		// calc most suitable range
+		New_Range = Get_Best_Current_Range_From_Value(AI_Curr);
+	}
+	// make sure this is not going out of boundaries & the range is enabled
+	if (New_Range > Curr_range_max_ID) New_Range = Curr_range_max_ID;
+	New_Range = Check_Current_Range_Enabled_Correct(New_Range);
+	
+	return New_Range;
+}
+
 //-------------------------------------------------------------------------------------------
 // Measure current and voltage of IV point
 void IV_MEAS__Meas_Curr_Volt_Point(float Volt_AVR_Mult, float Curr_AVR_Mult){
@@ -557,6 +1578,236 @@ void IV_MEAS__Meas_Curr_Volt_Point(float Volt_AVR_Mult, float Curr_AVR_Mult){
 	
 }
 
+//-------------------------------------------------------------------------------------------
+// Measure current and voltage of IV point with sequential averaging
+void IV_MEAS__Meas_Curr_Volt_Point_Seq(uint8_t Data_Point){
+	/* function measures current & voltage signals after settling, set by set until the point is known well enough
+	- the running mean & variance of the set averages is tracked for both channels (Welford)
+	- stops when the standard error of both channels is below the target, but not before the configured number of sets
+	- stops at the latest after the maximum number of sets
+	- number of sets & larger standard error in ADC counts are stored with the IV point
+	*/
+	// need those variables
+	uint8_t n, Min_Sets, Max_Sets;
+	uint32_t Sum_Volt, Sum_Curr, Set_Sum;
+	float Set_Mult, X, Delta;
+	float Mean_Volt, M2_Volt, Mean_Curr, M2_Curr;
+	float SE2_Target, SE2_Volt, SE2_Curr;
+	Sum_Volt = 0;
+	Sum_Curr = 0;
+	Mean_Volt = 0;
+	M2_Volt = 0;
+	Mean_Curr = 0;
+	M2_Curr = 0;
+	SE2_Volt = 0;
+	SE2_Curr = 0;
+	Set_Mult = 1.0 / (float) IV_Point_Meas_Nu_AVR_VoltCurr;
+	SE2_Target = IV_Seq_SE_Target * IV_Seq_SE_Target;
+	// limits of number of sets
+	Min_Sets = IV_Point_Meas_Nu_AVR_Sets;
+	if (Min_Sets < IV_SEQ_MIN_SETS) Min_Sets = IV_SEQ_MIN_SETS;
+	Max_Sets = IV_Seq_Max_Sets;
+	if (Max_Sets < Min_Sets) Max_Sets = Min_Sets;
+	
+	// measure current and voltage sets
+	n = 0;
+	while (n < Max_Sets) {
+		// measure Voltage
+		Set_ADC_Mux_Voltage; // set voltage input MUX address
+		_delay_us(ADC_MUX_Set_Delay_us); // time it takes to set the channel and settle the signal at the ADC
+		Set_Sum = ADC_Convert_Avr_OLUL_MAX11163(IV_Point_Meas_Nu_AVR_VoltCurr);	// measure Voltage channel
+		Sum_Volt = Sum_Volt + Set_Sum;
+		X = (float) Set_Sum * Set_Mult;
+		// get voltage OL & UL flags
+		if (AI_Under_Load) {
+			SET__IV_Report_Volt_Under_Load;
+		}
+		else if (AI_Over_Load) {
+			SET__IV_Report_Volt_Over_Load;
+		}
+		// measure Current
+		Set_ADC_Mux_Current;
+		_delay_us(ADC_MUX_Set_Delay_us); // time it takes to set the channel and settle the signal at the ADC
+		Set_Sum = ADC_Convert_Avr_OLUL_MAX11163(IV_Point_Meas_Nu_AVR_VoltCurr);	// measure Current channel
+		Sum_Curr = Sum_Curr + Set_Sum;
+		// get current OL & UL flags
+		if (AI_Under_Load) {
+			SET__IV_Report_Curr_Under_Load;
+		}
+		else if (AI_Over_Load) {
+			SET__IV_Report_Curr_Over_Load;
+		}
+		n++;
+		// update running mean & variance of the set averages
+		Delta = X - Mean_Volt;
+		Mean_Volt = Mean_Volt + Delta / (float) n;
+		M2_Volt = M2_Volt + Delta * (X - Mean_Volt);
+		X = (float) Set_Sum * Set_Mult;
+		Delta = X - Mean_Curr;
+		Mean_Curr = Mean_Curr + Delta / (float) n;
+		M2_Curr = M2_Curr + Delta * (X - Mean_Curr);
+		// check squared standard error of the means
+		if (n >= Min_Sets) {
+			X = 1.0 / ((float) n * (float) (n - 1));
+			SE2_Volt = M2_Volt * X;
+			SE2_Curr = M2_Curr * X;
+			if ((SE2_Volt <= SE2_Target) && (SE2_Curr <= SE2_Target)) break;
+		}
+	}
+	// make last asymmetric Voltage measurement if requested
+	Set_Mult = Set_Mult / (float) n;
+	if (is_IV_Mode__Asym_Volt) {
+		Set_ADC_Mux_Voltage; // set voltage input MUX address
+		_delay_us(ADC_MUX_Set_Delay_us); // time it takes to set the channel and settle the signal at the ADC
+		Sum_Volt = Sum_Volt + ADC_Convert_Avr_OLUL_MAX11163(IV_Point_Meas_Nu_AVR_VoltCurr);	// measure Voltage channel
+		// get voltage OL & UL flags
+		if (AI_Under_Load) {
+			SET__IV_Report_Volt_Under_Load;
+		}
+		else if (AI_Over_Load) {
+			SET__IV_Report_Volt_Over_Load;
+		}
+		X = 1.0 / ((float) IV_Point_Meas_Nu_AVR_VoltCurr * ((float) n + 1.0));
+	}
+	else X = Set_Mult;
+	// Calculate results
+	AI_Volt = (((float) Sum_Volt * X) + AI_Volt_Offset) * AI_Volt_Scale;
+	AI_Curr = (((float) Sum_Curr * Set_Mult) + AI_Curr_Offset) * AI_Curr_Scale;
+	AI_Curr_Corr = AI_Curr + AI_Volt * AI_Volt_R_Leak;
+	// store achieved number of sets & larger standard error
+	if (SE2_Curr > SE2_Volt) SE2_Volt = SE2_Curr;
+	X = sqrt(SE2_Volt) * IV_SEQ_SE_SCALE;
+	if (X > 65535.0) X = 65535.0;
+	PV_IV_Nu_Sets[Data_Point] = n;
+	PV_IV_Std_Err[Data_Point] = (uint16_t) X;
+	
+}
+
+//-------------------------------------------------------------------------------------------
+// Mini IV sweep around set-point, returns voltage at estimated maximum power
+float IV_MEAS__Mini_Sweep_Get_Vmp(){
+	/* function measures a few IV points in a window around the actual set-point for fast MPPT re-centering
+	- no range selection, the active ranges are used
+	- the window is clamped to 0V and the Voc of the last Voc range search, the points are spaced within the clamped window
+	- a parabola is fitted to the local power curve, the voltage at its peak is returned if within the window
+	- otherwise the voltage at the highest measured power is returned
+	- temperatures & bias voltage are checked while each point settles as in the IV sweep, on over temperature the set-point is restored & returned
+	- the power of each point is integrated over the time since the previous point for the energy accumulators
+	- IV data buffer and IV report of the last IV curve are not changed
+	*/
+	// need those variables
+	float Volt_AVR_Mult, Curr_AVR_Mult;
+	float Volt_Set, Volt_Center, Volt_Window, Volt_Step, Volt_Low, Volt_High;
+	float U, P, P_Best, V_Best;
+	float S1, S2, S3, S4, T0, T1, T2;
+	float Det, A, B, N;
+	uint8_t i, k, Nu_Points, IV_Report_Old;
+	uint16_t j;
+	uint32_t Tick_Act, Tick_Last;
+	bool STOP_IV;
+	
+	// limit number of points
+	Nu_Points = IV_Mini_Points;
+	if (Nu_Points > IV_MINI_MAX_POINTS) Nu_Points = IV_MINI_MAX_POINTS;
+	else if (Nu_Points < MIN_IV_POINTS) Nu_Points = MIN_IV_POINTS;
+	N = (float) Nu_Points;
+	IV_Report_Old = IV_Report;
+	
+	// voltage window around set-point, at least one maximum MPPT step
+	Volt_Set = PV_Volt_DAC_ACT;
+	Volt_Center = Volt_Set;
+	Volt_Window = Volt_Center * IV_Mini_Window_Fact;
+	if (Volt_Window < (AI_Volt_Scale * LOAD_MPPT_Max_Step_CND)) Volt_Window = AI_Volt_Scale * LOAD_MPPT_Max_Step_CND;
+	// clamp window to 0V & Voc, a Voc below the set-point is outdated and not used
+	Volt_Low = Volt_Center - Volt_Window;
+	Volt_High = Volt_Center + Volt_Window;
+	if (Volt_Low < 0) Volt_Low = 0;
+	if ((IV_Voc_Last > Volt_Center) && (Volt_High > IV_Voc_Last)) Volt_High = IV_Voc_Last;
+	if (Volt_High <= Volt_Low) return Volt_Center;
+	// fit is centred in the clamped window
+	Volt_Center = 0.5 * (Volt_High + Volt_Low);
+	Volt_Window = 0.5 * (Volt_High - Volt_Low);
+	Volt_Step = (Volt_High - Volt_Low) / (N - 1.0);
+	
+	// calc variables for averaging
+	IV_MEAS__Calc_AVR_Mult(&Volt_AVR_Mult, &Curr_AVR_Mult);
+	
+	// measure points & sum up for least squares fit, voltage normalised to window
+	S1 = 0; S2 = 0; S3 = 0; S4 = 0;
+	T0 = 0; T1 = 0; T2 = 0;
+	P_Best = -1000.0;
+	V_Best = Volt_Center;
+	STOP_IV = false;
+	Tick_Last = Get_Timer_Main_Ticks();
+	for (i=0; i < Nu_Points; i++) {
+		Set_DAC_Output_Volts(Volt_Low + Volt_Step * (float) i);
+		// wait until settled, measure temperatures & check bias voltage meanwhile as in the IV sweep
+		j = IV_Point_Set_Delay_ms;
+		k = 0;
+		while (j) {
+			wdt_reset();
+			if (k == 1) {
+				if (meas_NTC1_Temp_control_fan_over_Temp()) STOP_IV = true;
+				_delay_us(403);
+			}
+			else if (k == 2) {
+				if (meas_NTC2_Temp_control_fan_over_Temp()) STOP_IV = true;
+				_delay_us(403);
+			}
+			else if (k == 3) {
+				meas_Bias_Volt_Range_Check();
+				_delay_us(655);
+			}
+			else {
+				_delay_us(999);
+			}
+			if (STOP_IV) break;
+			j--;
+			k++;
+			if(k >= 10) k = 0;
+		}
+		if (STOP_IV) break;
+		IV_MEAS__Meas_Curr_Volt_Point(Volt_AVR_Mult, Curr_AVR_Mult);
+		P = AI_Volt * AI_Curr_Corr;
+		Tick_Act = Get_Timer_Main_Ticks();
+		IV_Block_Ticks = IV_Block_Ticks + (Tick_Act - Tick_Last);
+		IV_Block_Power_Ticks = IV_Block_Power_Ticks + P * (float) (Tick_Act - Tick_Last);
+		Tick_Last = Tick_Act;
+		if (P > P_Best) {
+			P_Best = P;
+			V_Best = AI_Volt;
+		}
+		U = (AI_Volt - Volt_Center) / Volt_Window;
+		S1 = S1 + U;
+		S2 = S2 + U * U;
+		S3 = S3 + U * U * U;
+		S4 = S4 + U * U * U * U;
+		T0 = T0 + P;
+		T1 = T1 + U * P;
+		T2 = T2 + U * U * P;
+	}
+	IV_Report = IV_Report_Old;
+	Set_ADC_Mux_Voltage;
+	CLR__Status_MainTimerOverRun;
+	CLR__Timer_CTR_Main_Flag;
+	if (STOP_IV) {
+		// over temperature, back to the set-point
+		Set_DAC_Output_Volts(Volt_Set);
+		return Volt_Set;
+	}
+	
+	// fit P = A*U^2 + B*U + C, solve normal equations with Cramer's rule
+	Det = S4 * (S2 * N - S1 * S1) - S3 * (S3 * N - S1 * S2) + S2 * (S3 * S1 - S2 * S2);
+	if (Det == 0) return V_Best;
+	A = (T2 * (S2 * N - S1 * S1) - S3 * (T1 * N - S1 * T0) + S2 * (T1 * S1 - S2 * T0)) / Det;
+	B = (S4 * (T1 * N - S1 * T0) - T2 * (S3 * N - S1 * S2) + S2 * (S3 * T0 - T1 * S2)) / Det;
+	// peak only if power curve is bent downwards and peak is within the window
+	if (A >= 0) return V_Best;
+	U = -B / (2.0 * A);
+	if ((U > 1.0) || (U < -1.0)) return V_Best;
+	return Volt_Center + U * Volt_Window;
+}
+
 //-------------------------------------------------------------------------------------------
 // find the DAC Voltage at maximum power
 float get_DAC_Volt_at_Pmax_from_IV(){
@@ -568,7 +1819,7 @@ float get_DAC_Volt_at_Pmax_from_IV(){
 	// preset
 	V_Pmax = 0;
 	Pmax = 0;
-	i = IV_Meas_Points;
+	i = IV_Data_Points;
 	
 	while (i)
 	{
@@ -583,6 +1834,54 @@ float get_DAC_Volt_at_Pmax_from_IV(){
 	return V_Pmax;
 }
 
+//-------------------------------------------------------------------------------------------
+// find the DAC Voltage at the crossing with a load line
+float get_DAC_Volt_at_Load_Line_from_IV(float Curr, float Cond){
+	/* this function returns the DAC control Voltage at which the IV curve crosses the load line I = Curr + Cond * V
+	- Cond = 0 gives the voltage at a given current, Curr = 0 the voltage at a given resistance 1/Cond
+	- linear interpolation between the first two neighbouring IV points the load line is between
+	- IV data may be in any order (reverse, hysteresis sweeps)
+	- returns -1 if the load line does not cross the curve
+	*/
+	// initialize the variables
+	float I_A, I_B;
+	uint8_t i;
+	
+	for (i=1; i < IV_Data_Points; i++) {
+		I_A = PV_IV_Current[i-1] - (Curr + Cond * PV_IV_Voltage[i-1]);
+		I_B = PV_IV_Current[i] - (Curr + Cond * PV_IV_Voltage[i]);
+		if ((I_A * I_B) <= 0) {
+			if (I_A == I_B) return PV_IV_Voltage[i];
+			return PV_IV_Voltage[i-1] + (PV_IV_Voltage[i] - PV_IV_Voltage[i-1]) * I_A / (I_A - I_B);
+		}
+	}
+	
+	return -1.0;
+}
+
+//-------------------------------------------------------------------------------------------
+// find the maximum power of a section of the IV data
+float get_Pmax_from_IV_Section(uint8_t Start, uint8_t Nu_Points){
+	/* this function returns the maximum power of the IV points from start point on
+	- used to compare forward and reverse curves of the hysteresis sweep
+	*/
+	// initialize the variables
+	float Pmax, P_actual;
+	uint8_t i;
+	// preset
+	Pmax = 0;
+	i = Nu_Points;
+	
+	while (i)
+	{
+		i--;
+		P_actual = PV_IV_Voltage[Start+i] * PV_IV_Current[Start+i];
+		if (P_actual > Pmax) Pmax = P_actual;
+	}
+	
+	return Pmax;
+}
+
 
 //-------------------------------------------------------------------------------------------
 // IV curve measure NTC 1 temperature & control fans & over temperature
@@ -26,6 +26,30 @@
 #define IV_Setup_Max_Delay_For_Mul 20000 // max PV delay to apply multiplier, or just use maximum value, linked to above
 #define IV_Temp_Bias_Mon_No_Meas 20 // number of averages of bias and temperature measurements
 #define IV_Temp_Bias_Mon_No_Meas_Devider (1.0/IV_Temp_Bias_Mon_No_Meas) //average divider
+#define IV_MINI_MAX_POINTS 15 // maximum number of points of the mini IV sweep around the set-point
+#define IV_SINE_TABLE_SIZE 64 // number of intervals of the quarter wave sine table
+#define IV_PI_HALF 1.570796
+#define IV_SEQ_MIN_SETS 2 // minimum number of sets for the standard error of sequential averaging
+#define IV_SEQ_SE_SCALE 16.0 // stored standard error resolution, 1/16 ADC counts
+#define IV_DWELL_REGIONS 8 // number of voltage regions of the learned dwell map, equal fractions of Voc
+#define IV_DWELL_TRACE_MAX 16 // maximum number of settle trace samples per IV point
+#define IV_DWELL_TRACE_AVR 4 // number of averaged conversions per settle trace sample
+#define IV_DWELL_TRACE_T0_MS 0.1 // time from start of the dwell millisecond to the trace sample
+#define IV_Dwell_Trace_us 130 // time it takes to record one settle trace sample
+#define IV_DWELL_NOISE_COUNTS 8.0 // current deviation in ADC counts below which a point is regarded as settled
+#define IV_DWELL_MIN_MS 4 // minimum learned dwell time, the temperature & bias checks run in the 2nd to 4th dwell millisecond
+#define IV_PREEMPH_MAX_US 5000 // maximum DAC overdrive time
+#define IV_PREEMPH_MIN_STEP_COUNTS 64.0 // minimum transient voltage step in ADC counts to learn the time constant
+#define IV_SEG_MAX 4 // maximum number of IV sweep profile segments
+#define IV_RAMP_NU_AVR 4 // number of averaged ADC conversions per voltage & current sample of the ramp IV measurement
+#define IV_RAMP_MAX_TIME_S 10.0 // maximum duration of the ramp, limits the slowest slew rate (no temperature checks during the ramp)
+#define IV_CSTEP_PRE_POINTS 20 // number of points of the coarse pre-sweep of current stepped IV measurements
+#define IV_Range_Set_Time_ms 20 // time the range set functions take, incl. latch relay pulse & delays
+#define IV_Meas_Set_Time_ms 0.22 // time per measurement set for mux settling & overhead
+#define IV_Meas_Conv_Time_ms 0.011 // time per averaged ADC conversion
+#define IV_Dwell_Temp_Extra_ms 0.275 // extra time of the temperature measurement steps in the point settling loop
+#define IV_Point_Overhead_ms 0.1 // calculation time per IV point (data transfer & energy integration)
+#define IV_Point_Cos_Calc_ms 0.15 // calculation time per cosine distributed voltage point
 
 //	IV_Mode:
 //		Bit0:	IV_Mode__Cos_Sweep
@@ -40,12 +64,63 @@
 			#define SET__IV_Mode__Reverse (SETBIT(IV_Mode, 2))
 			#define CLR__IV_Mode__Reverse (CLRBIT(IV_Mode, 2))
 			#define is_IV_Mode__Reverse (IV_Mode & BIT(2))
-//		Bit3:	none
+//		Bit3:	IV_Mode__Hyst_Sweep
+			#define SET__IV_Mode__Hyst_Sweep (SETBIT(IV_Mode, 3))
+			#define CLR__IV_Mode__Hyst_Sweep (CLRBIT(IV_Mode, 3))
+			#define is_IV_Mode__Hyst_Sweep (IV_Mode & BIT(3))
+//		Bit4:	IV_Mode__MPP_Split
+			#define SET__IV_Mode__MPP_Split (SETBIT(IV_Mode, 4))
+			#define CLR__IV_Mode__MPP_Split (CLRBIT(IV_Mode, 4))
+			#define is_IV_Mode__MPP_Split (IV_Mode & BIT(4))
+//		Bit5:	IV_Mode__Dyn_Curr_Range
+			#define SET__IV_Mode__Dyn_Curr_Range (SETBIT(IV_Mode, 5))
+			#define CLR__IV_Mode__Dyn_Curr_Range (CLRBIT(IV_Mode, 5))
+			#define is_IV_Mode__Dyn_Curr_Range (IV_Mode & BIT(5))
+//		Bit6:	IV_Mode__Seg_Sweep
+			#define SET__IV_Mode__Seg_Sweep (SETBIT(IV_Mode, 6))
+			#define CLR__IV_Mode__Seg_Sweep (CLRBIT(IV_Mode, 6))
+			#define is_IV_Mode__Seg_Sweep (IV_Mode & BIT(6))
+//		Bit7:	IV_Mode__Curr_Step
+			#define SET__IV_Mode__Curr_Step (SETBIT(IV_Mode, 7))
+			#define CLR__IV_Mode__Curr_Step (CLRBIT(IV_Mode, 7))
+			#define is_IV_Mode__Curr_Step (IV_Mode & BIT(7))
+
+//	IV_Data_Content:
+//		Bit0:	IV_Data_Curr_Range, current range ID is transfered with each IV point
+			#define SET__IV_Data_Curr_Range (SETBIT(IV_Data_Content, 0))
+			#define CLR__IV_Data_Curr_Range (CLRBIT(IV_Data_Content, 0))
+			#define is_IV_Data_Curr_Range (IV_Data_Content & BIT(0))
+//		Bit1:	IV_Data_Seq_Stats, number of measurement sets & standard error is transfered with each IV point
+			#define SET__IV_Data_Seq_Stats (SETBIT(IV_Data_Content, 1))
+			#define CLR__IV_Data_Seq_Stats (CLRBIT(IV_Data_Content, 1))
+			#define is_IV_Data_Seq_Stats (IV_Data_Content & BIT(1))
+//		Bit2:	IV_Data_Point_Flags, quality flag byte is transfered with each IV point
+			#define SET__IV_Data_Point_Flags (SETBIT(IV_Data_Content, 2))
+			#define CLR__IV_Data_Point_Flags (CLRBIT(IV_Data_Content, 2))
+			#define is_IV_Data_Point_Flags (IV_Data_Content & BIT(2))
+//		Bit3:	IV_Data_Valid_Curve, buffer holds the calibrated IV curve of a completed sweep, not transient ADC counts or an aborted sweep
+			#define SET__IV_Data_Valid_Curve (SETBIT(IV_Data_Content, 3))
+			#define CLR__IV_Data_Valid_Curve (CLRBIT(IV_Data_Content, 3))
+			#define is_IV_Data_Valid_Curve (IV_Data_Content & BIT(3))
 //		Bit4:	none
 //		Bit5:	none
 //		Bit6:	none
 //		Bit7:	none
 
+//	PV_IV_Flags (quality flags of each IV point, bits 0, 2 & 4 ... 7 as IV_Report):
+//		Bit0:	overcurrent bypass active at the point
+			#define IV_Flag__Bypass (BIT(0))
+//		Bit1:	current range changed at the point, measured again in new range
+			#define IV_Flag__Range_Change (BIT(1))
+//		Bit2:	bias voltage out of range while settling the point
+//		Bit3:	current not settled at end of dwell (only detected with dwell learning)
+			#define IV_Flag__Not_Settled (BIT(3))
+//		Bit4:	voltage ADC over-load
+//		Bit5:	voltage ADC under-load
+//		Bit6:	current ADC over-load
+//		Bit7:	current ADC under-load
+			#define IV_Flag__Report_Mask (0b11110100)	// per point IV_Report bits
+
 //	IV_Report:
 //		Bit0:	IV_Report_OverCurr_Bypass_Active
 			#define SET__IV_Report_OverCurr_Bypass_Active (SETBIT(IV_Report, 0))
@@ -66,6 +141,7 @@
 //		Bit6:	IV_Report_Curr_AI_Over_R
 			#define SET__IV_Report_Curr_Over_Load (SETBIT(IV_Report, 6))
 			#define CLR__IV_Report_Curr_Over_Load (CLRBIT(IV_Report, 6))
+			#define is_IV_Report_Curr_Over_Load (IV_Report & BIT(6))
 //		Bit7:	IV_Report_Curr_AI_Under_R
 			#define SET__IV_Report_Curr_Under_Load (SETBIT(IV_Report, 7))
 			#define CLR__IV_Report_Curr_Under_Load (CLRBIT(IV_Report, 7))
@@ -89,8 +165,43 @@ extern volatile uint16_t IV_Setup_Signal_Set_Time;
 extern volatile uint8_t IV_Point_Meas_Nu_AVR_Sets;
 extern volatile uint8_t IV_Point_Meas_Nu_AVR_VoltCurr;
 extern volatile uint8_t IV_Report;
+extern volatile uint8_t IV_Data_Points;
+extern volatile uint8_t IV_Data_Content;
+extern volatile float IV_Hyst_Index;
+extern volatile float IV_Sweep_Energy_Lost;
+extern volatile uint32_t IV_Block_Ticks;
+extern volatile float IV_Block_Power_Ticks;
+extern volatile uint8_t IV_Mini_Points;
+extern volatile float IV_Mini_Window_Fact;
+extern volatile float IV_Ramp_Rate;
+extern volatile float IV_Seq_SE_Target;
+extern volatile uint8_t IV_Dwell_Learn;
+extern volatile float IV_Dwell_Tau_Mult;
+extern volatile float IV_Preemph_Gain;
+extern volatile uint8_t IV_Point_Flags_On;
+extern volatile float IV_Preemph_Tau_us;
+extern volatile float IV_Dwell_Tau_ms[IV_DWELL_REGIONS];
+extern volatile uint16_t IV_Dwell_Map_ms[IV_DWELL_REGIONS];
+extern volatile uint8_t IV_Seq_Max_Sets;
+extern volatile uint8_t IV_Seg_Count;
+extern volatile float IV_Seg_End_Voc_Fact[IV_SEG_MAX];
+extern volatile uint8_t IV_Seg_Points[IV_SEG_MAX];
+extern volatile uint16_t IV_Seg_Delay_ms[IV_SEG_MAX];
+extern volatile uint8_t IV_Seg_Nu_AVR_VoltCurr[IV_SEG_MAX];
+extern volatile uint16_t IV_Sched_Interval_s;
+extern volatile uint16_t IV_Sched_Stagger_s;
+extern volatile uint32_t IV_Sched_Tick_Next;
+extern volatile uint16_t IV_Curve_Count;
+extern volatile uint16_t IV_Curve_Lost;
+extern volatile uint32_t IV_Curve_Tick;
+extern volatile uint32_t IV_Time_Predicted_ms;
+extern volatile uint32_t IV_Time_Actual_ms;
 extern volatile float PV_IV_Current[MAX_IV_POINTS];
 extern volatile float PV_IV_Voltage[MAX_IV_POINTS];
+extern volatile uint8_t PV_IV_Curr_Range[MAX_IV_POINTS];
+extern volatile uint8_t PV_IV_Nu_Sets[MAX_IV_POINTS];
+extern volatile uint16_t PV_IV_Std_Err[MAX_IV_POINTS];
+extern volatile uint8_t PV_IV_Flags[MAX_IV_POINTS];
 
 //===========================================================================================
 // EXTERN EEPROM VARIABLES
@@ -101,15 +212,60 @@ extern EEMEM float EROM_IV_Voc_Overshoot_Fact;
 extern EEMEM uint16_t EROM_IV_Point_Set_Delay_ms;
 extern EEMEM uint8_t EROM_IV_Point_Meas_Nu_AVR_Sets;
 extern EEMEM uint8_t EROM_IV_Point_Meas_Nu_AVR_VoltCurr;
+extern EEMEM uint8_t EROM_IV_Mini_Points;
+extern EEMEM float EROM_IV_Mini_Window_Fact;
+extern EEMEM float EROM_IV_Ramp_Rate;
+extern EEMEM float EROM_IV_Seq_SE_Target;
+extern EEMEM uint8_t EROM_IV_Dwell_Learn;
+extern EEMEM float EROM_IV_Dwell_Tau_Mult;
+extern EEMEM float EROM_IV_Preemph_Gain;
+extern EEMEM uint8_t EROM_IV_Point_Flags_On;
+extern EEMEM float EROM_IV_Preemph_Tau_us;
+extern EEMEM uint8_t EROM_IV_Seq_Max_Sets;
+extern EEMEM uint8_t EROM_IV_Seg_Count;
+extern EEMEM float EROM_IV_Seg_End_Voc_Fact[IV_SEG_MAX];
+extern EEMEM uint8_t EROM_IV_Seg_Points[IV_SEG_MAX];
+extern EEMEM uint16_t EROM_IV_Seg_Delay_ms[IV_SEG_MAX];
+extern EEMEM uint8_t EROM_IV_Seg_Nu_AVR_VoltCurr[IV_SEG_MAX];
+extern EEMEM uint16_t EROM_IV_Sched_Interval_s;
+extern EEMEM uint16_t EROM_IV_Sched_Stagger_s;
 
 //===========================================================================================
 // FUNCTION Prototypes
 void PV_IV_MEAS();
 void PV_TRANS_MEAS();
 float IV_MEAS__Get_Voc_Set_Optimum_Range();
+float IV_MEAS__Get_Voc_Fast(uint8_t Settle_ms);
 void IV_MEAS__Get_Curr_Optimum_Range();
 void IV_MEAS__Meas_Curr_Volt_Point(float Volt_AVR_Mult, float Curr_AVR_Mult);
+void IV_MEAS__Meas_Curr_Volt_Point_Seq(uint8_t Data_Point);
+uint8_t IV_MEAS__Get_Dwell_Region(float Voltage);
+uint16_t IV_MEAS__Get_Dwell_ms(uint8_t Region);
+float IV_MEAS__Dwell_Fit_Tau_ms(uint16_t *Trace, uint16_t *Trace_ms, uint8_t Nu_Trace, float Final, float Step);
+void IV_MEAS__Dwell_Map_Reset();
+void IV_MEAS__Dwell_Map_Update();
+uint16_t IV_MEAS__Get_Preemph_Time_us();
+void IV_MEAS__Set_DAC_Preemph(uint16_t DAC_Counts, float Voltage, uint16_t Time_us);
+void TRANS_MEAS__Learn_Preemph_Tau();
+void IV_MEAS__Calc_DAC_Counts(uint8_t Nu_Points);
+float IV_Get_Sine(float Phase);
+void IV_MEAS__Calc_AVR_Mult(float *Volt_AVR_Mult, float *Curr_AVR_Mult);
+uint8_t IV_MEAS__Calc_Segment_Points(float Voc);
+void IV_MEAS__Calc_Curr_Step_Points(float Volt_End, uint8_t Nu_Points, float Volt_AVR_Mult, float Curr_AVR_Mult);
+bool IV_MEAS__Sweep_Segments(bool Reverse);
+void IV_MEAS__Ramp_Sweep(float Volt_End, uint8_t Nu_Points, bool Reverse);
+uint8_t IV_MEAS__Get_Dyn_Curr_Range(bool Curr_Over_Load);
+bool IV_MEAS__Sweep_Points(uint8_t DAC_Start, uint8_t Nu_Points, uint8_t Data_Offset, bool Reverse, float Volt_AVR_Mult, float Curr_AVR_Mult);
+void IV_MEAS__Calc_Energy_Lost(float Power_Start, uint32_t Tick_Start);
+void IV_MEAS__Reverse_Points(uint8_t Start, uint8_t Nu_Points);
+uint32_t IV_MEAS__Predict_Time_ms();
+float IV_MEAS__Predict_Point_Time_ms(uint16_t Delay_ms, uint8_t Nu_AVR_VoltCurr);
+void IV_Schedule_Reset();
+void IV_Schedule_Process();
+float IV_MEAS__Mini_Sweep_Get_Vmp();
 float get_DAC_Volt_at_Pmax_from_IV();
+float get_DAC_Volt_at_Load_Line_from_IV(float Curr, float Cond);
+float get_Pmax_from_IV_Section(uint8_t Start, uint8_t Nu_Points);
 bool meas_NTC1_Temp_control_fan_over_Temp();
 bool meas_NTC2_Temp_control_fan_over_Temp();
 void meas_Bias_Volt_Range_Check();
@@ -58,11 +58,83 @@ volatile float LOAD_MPPT_Step_Reduction_Fact;
 volatile float LOAD_MPPT_Tolerance_CND;
 volatile uint16_t LOAD_MPPT_Timer_Update_Delay;
 volatile uint16_t LOAD_MPPT_Update_Counter;
+volatile uint16_t LOAD_MPPT_Mini_IV_Interval;	// control cycles between mini IV sweeps, 0 = off
+volatile uint16_t LOAD_MPPT_Mini_IV_Counter;
+volatile float Track_Volt_Old;
+volatile float Track_Curr_Old;
+volatile float LOAD_IncC_Cond_Band;		// relative band around dI/dV = -I/V treated as at the MPP
+volatile float LOAD_IncC_Volt_Noise_CND;	// voltage change below this is treated as no change
+volatile float LOAD_IncC_Curr_Noise_CND;	// current change below this is treated as no change
+volatile float Track_Dither_Offset;	// P&O offset of the model MPPT from the predicted Vmp
+volatile bool LOAD_SDM_Valid;		// single diode model fitted to last IV curve
+volatile float LOAD_SDM_Iph;		// photo current, updated from the operating point
+volatile float LOAD_SDM_I0;			// diode saturation current at fit temperature
+volatile float LOAD_SDM_A;			// modified ideality factor n*Ns*k*T/q at fit temperature in [V]
+volatile float LOAD_SDM_Rs;			// series resistance
+volatile float LOAD_SDM_Gsh;		// shunt conductance, 1/Rsh
+volatile float LOAD_SDM_T_Fit_K;	// device temperature at fit in [K]
+volatile float LOAD_SDM_Vd_Mp;		// diode voltage at the predicted MPP, start value of the next search
+volatile float LOAD_SDM_Vmp;		// last predicted Vmp
+volatile uint8_t Track_GSS_State;	// golden section search state
+volatile float Track_GSS_Low;		// bracket of the golden section search
+volatile float Track_GSS_High;
+volatile float Track_GSS_X1;		// lower & upper inner points and their power
+volatile float Track_GSS_X2;
+volatile float Track_GSS_P1;
+volatile float Track_GSS_P2;
+volatile float Track_GSS_P_Hold;	// power reference after convergence
+volatile float LOAD_GSS_Low_Voc_Fact;	// start bracket as fractions of Voc
+volatile float LOAD_GSS_High_Voc_Fact;
+volatile float LOAD_GSS_Drift_Fact;		// relative power drift that restarts the search
+volatile float LOAD_FVoc_Fact;			// fractional Voc set-point factor Vmp/Voc, 0 = auto-calibrate from IV curve
+volatile uint16_t LOAD_FVoc_Interval;	// control cycles between Voc samples
+volatile uint8_t LOAD_FVoc_Settle_ms;	// settle time of the open load Voc sample
+volatile float LOAD_FVoc_Fact_Act;		// active factor, set or calibrated
+volatile float LOAD_FVoc_Voc;			// last sampled Voc
+volatile uint16_t LOAD_FVoc_Counter;
 volatile float LOAD_CurrT_Max_Step_CND;
-volatile float LOAD_CurrT_Min_Step_CND;
-volatile float LOAD_CurrT_Step_Increase_Fact;
-volatile float LOAD_CurrT_Step_Reduction_Fact;
 volatile float LOAD_CurrT_Tolerance_CND;
+volatile float LOAD_CurrT_PID_Kp;	// current PID gains in voltage DAC counts per current ADC count
+volatile float LOAD_CurrT_PID_Ki;
+volatile float LOAD_CurrT_PID_Kd;
+volatile float Track_PID_Integral;	// integral part of the current PID in volts
+volatile uint16_t LOAD_CurrT_FF_Max_Age_s;	// max. age of the IV curve for the start set-point, 0 = off
+
+// Output power control variables
+volatile float PV_Pow_Setpoint;		// constant power control set-point
+volatile uint8_t LOAD_Pow_Isc_Side;	// regulate power on the Isc side of Pmp instead of the Voc side
+volatile float LOAD_Pow_Volt_Limit;	// Vmp of last IV curve, power control doesn't cross it, 0 = unknown
+
+// Output resistance control variables
+volatile float PV_Res_Setpoint;		// constant resistance control set-point
+
+// Set-point profile variables
+volatile uint8_t LOAD_Prof_Count;		// number of profile steps used, 0 = no profile
+volatile uint8_t LOAD_Prof_Mode[LOAD_PROF_MAX_STEPS];		// load mode of each step
+volatile float LOAD_Prof_Setpoint[LOAD_PROF_MAX_STEPS];		// set-point of each step, unit depends on the mode
+volatile uint16_t LOAD_Prof_Duration_s[LOAD_PROF_MAX_STEPS];	// duration of each step in [s]
+volatile uint8_t LOAD_Prof_Repeat[LOAD_PROF_MAX_STEPS];		// returns to the first step after each step, 255 = endless
+volatile uint8_t LOAD_Prof_State;		// profile state, stopped, running or paused
+volatile uint8_t LOAD_Prof_Step;		// active step
+volatile uint8_t LOAD_Prof_Repeat_Left[LOAD_PROF_MAX_STEPS];
+volatile uint32_t LOAD_Prof_Tick_Start;	// main timer tick the active step started at
+volatile uint32_t LOAD_Prof_Tick_Paused;	// main timer ticks of the active step elapsed when paused
+
+// Energy accumulator variables, per load mode, total since start-up & since last reset
+volatile int64_t LOAD_Energy_Tot_nWs[LOAD_ENERGY_MODES];		// energy delivered in [nWs]
+volatile int64_t LOAD_Charge_Tot_nAs[LOAD_ENERGY_MODES];		// charge delivered in [nAs]
+volatile int64_t LOAD_Energy_Ref_Tot_nWs[LOAD_ENERGY_MODES];	// energy delivered while the IV curve Pmp was known
+volatile int64_t LOAD_Energy_Pmp_Tot_nWs[LOAD_ENERGY_MODES];	// energy available at the IV curve Pmp
+volatile int64_t LOAD_Energy_Rst_nWs[LOAD_ENERGY_MODES];
+volatile int64_t LOAD_Charge_Rst_nAs[LOAD_ENERGY_MODES];
+volatile int64_t LOAD_Energy_Ref_Rst_nWs[LOAD_ENERGY_MODES];
+volatile int64_t LOAD_Energy_Pmp_Rst_nWs[LOAD_ENERGY_MODES];
+volatile uint8_t LOAD_Energy_Select = LOAD_ENERGY_ALL;	// load mode reported by the energy query
+volatile float LOAD_Energy_Pmp;			// Pmp of the last IV curve, 0 = unknown
+volatile uint16_t LOAD_Energy_IV_Count;	// IV curve count Pmp was taken from
+volatile uint32_t LOAD_Energy_Pmp_Tick;	// main timer tick at start of the IV curve Pmp was taken from
+volatile uint32_t LOAD_Energy_Tick_Last;	// main timer tick of the last integration
+volatile bool LOAD_Energy_Started;
 
 // Fan control variables
 volatile uint8_t FAN_CTR_State;
@@ -109,11 +181,31 @@ EEMEM float EROM_LOAD_MPPT_Step_Increase_Fact =  1.2;
 EEMEM float EROM_LOAD_MPPT_Step_Reduction_Fact =  0.6;
 EEMEM float EROM_LOAD_MPPT_Tolerance_CND = 300.0;
 EEMEM uint16_t EROM_LOAD_MPPT_Timer_Update_Delay = 1;
+EEMEM uint16_t EROM_LOAD_MPPT_Mini_IV_Interval = 0;
+EEMEM float EROM_LOAD_IncC_Cond_Band = 0.02;
+EEMEM float EROM_LOAD_IncC_Volt_Noise_CND = 100.0;
+EEMEM float EROM_LOAD_IncC_Curr_Noise_CND = 100.0;
+EEMEM float EROM_LOAD_GSS_Low_Voc_Fact = 0.5;
+EEMEM float EROM_LOAD_GSS_High_Voc_Fact = 0.95;
+EEMEM float EROM_LOAD_GSS_Drift_Fact = 0.05;
+EEMEM float EROM_LOAD_FVoc_Fact = 0.0;
+EEMEM uint16_t EROM_LOAD_FVoc_Interval = 400;
+EEMEM uint8_t EROM_LOAD_FVoc_Settle_ms = 5;
 EEMEM float EROM_LOAD_CurrT_Max_Step_CND =  200.0;
-EEMEM float EROM_LOAD_CurrT_Min_Step_CND =  1.0;
-EEMEM float EROM_LOAD_CurrT_Step_Increase_Fact =  1.2;
-EEMEM float EROM_LOAD_CurrT_Step_Reduction_Fact =  0.6;
+EEMEM float EROM_LOAD_CurrT_Reserved[3] = {1.0, 1.2, 0.6};	// register 161 ... 163, reserved to keep the EEPROM layout, not used since the PID controller
 EEMEM float EROM_LOAD_CurrT_Tolerance_CND = 5.0;
+EEMEM float EROM_LOAD_CurrT_PID_Kp = 0.5;
+EEMEM float EROM_LOAD_CurrT_PID_Ki = 0.2;
+EEMEM float EROM_LOAD_CurrT_PID_Kd = 0.0;
+EEMEM uint16_t EROM_LOAD_CurrT_FF_Max_Age_s = 600;
+EEMEM float EROM_PV_Pow_Setpoint = 0.0;
+EEMEM uint8_t EROM_LOAD_Pow_Isc_Side = 0;
+EEMEM float EROM_PV_Res_Setpoint = 0.0;
+EEMEM uint8_t EROM_LOAD_Prof_Count = 0;
+EEMEM uint8_t EROM_LOAD_Prof_Mode[LOAD_PROF_MAX_STEPS] = {0, 0, 0, 0, 0, 0};
+EEMEM float EROM_LOAD_Prof_Setpoint[LOAD_PROF_MAX_STEPS] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+EEMEM uint16_t EROM_LOAD_Prof_Duration_s[LOAD_PROF_MAX_STEPS] = {0, 0, 0, 0, 0, 0};
+EEMEM uint8_t EROM_LOAD_Prof_Repeat[LOAD_PROF_MAX_STEPS] = {0, 0, 0, 0, 0, 0};
 EEMEM uint8_t EROM_PV_Mode_CTR = 0;
 EEMEM float EROM_PV_Volt_Setpoint = 0.0;
 EEMEM float EROM_PV_Curr_Setpoint = 0.0;
@@ -135,6 +227,9 @@ void LOAD_CTR_MAIN(){
 	
 	// Calculate actual load power
 	PV_Active_Load_Power = AI_Volt * AI_Curr_Corr;
+	
+	// Integrate energy & charge
+	LOAD_Energy_Process();
 		
 	// Check if calibration mode entered!
 	if (is_SysControl_Cal_Mode) {
@@ -163,6 +258,11 @@ void LOAD_CTR_MAIN(){
 		// PV Control Enabled, indicate output enabled
 		// ... done in else cases now to reduce confusion
 		
+		// start scheduled IV measurement if due
+		IV_Schedule_Process();
+		
+		// advance set-point profile if step time is up
+		LOAD_Profile_Process();
 				
 		// check if IV Measurement requested
 		if (is_SysControl_IV_Meas) {		// IV measurement mode
@@ -172,6 +272,10 @@ void LOAD_CTR_MAIN(){
 				CLR__LED_Output_On;
 				CLR__Output_On; // disable PI-CTR output to keep at VOC
 				CLR__SysControl_IV_Meas; // chancel IV measurement
+				if (is_COM_Status_IV_Stream_On) { // end stream without points
+					Trans_IV_Point = IV_Data_Points;
+					UART_Stream_IV_Finish();
+				}
 			}
 			else {
 				SET__Status_Ouput_On;
@@ -248,6 +352,72 @@ void LOAD_CTR_MAIN(){
 					PV_Mode__MPPT_Simple_Init();
 				}
 			}
+			else if (PV_Mode_CTR == PV_Mode__MPPT_IncCond){
+				SET__Status_Ouput_On;
+				SET__LED_Output_On;
+				SET__Output_On; // enable PI-CTR output
+				if(PV_Mode_ACT == PV_Mode_CTR) {
+					PV_Mode__MPPT_IncCond_Main();
+				}
+				else {
+					PV_Mode__MPPT_IncCond_Init();
+				}
+			}
+			else if (PV_Mode_CTR == PV_Mode__MPPT_Model){
+				SET__Status_Ouput_On;
+				SET__LED_Output_On;
+				SET__Output_On; // enable PI-CTR output
+				if(PV_Mode_ACT == PV_Mode_CTR) {
+					PV_Mode__MPPT_Model_Main();
+				}
+				else {
+					PV_Mode__MPPT_Model_Init();
+				}
+			}
+			else if (PV_Mode_CTR == PV_Mode__MPPT_Golden){
+				SET__Status_Ouput_On;
+				SET__LED_Output_On;
+				SET__Output_On; // enable PI-CTR output
+				if(PV_Mode_ACT == PV_Mode_CTR) {
+					PV_Mode__MPPT_Golden_Main();
+				}
+				else {
+					PV_Mode__MPPT_Golden_Init();
+				}
+			}
+			else if (PV_Mode_CTR == PV_Mode__Const_Power){
+				SET__Status_Ouput_On;
+				SET__LED_Output_On;
+				SET__Output_On; // enable PI-CTR output
+				if(PV_Mode_ACT == PV_Mode_CTR) {
+					PV_Mode__Constant_Power_Main();
+				}
+				else {
+					PV_Mode__Constant_Power_Init();
+				}
+			}
+			else if (PV_Mode_CTR == PV_Mode__Const_Res){
+				SET__Status_Ouput_On;
+				SET__LED_Output_On;
+				SET__Output_On; // enable PI-CTR output
+				if(PV_Mode_ACT == PV_Mode_CTR) {
+					PV_Mode__Constant_Resistance_Main();
+				}
+				else {
+					PV_Mode__Constant_Resistance_Init();
+				}
+			}
+			else if (PV_Mode_CTR == PV_Mode__MPPT_FVoc){
+				SET__Status_Ouput_On;
+				SET__LED_Output_On;
+				SET__Output_On; // enable PI-CTR output
+				if(PV_Mode_ACT == PV_Mode_CTR) {
+					PV_Mode__MPPT_FVoc_Main();
+				}
+				else {
+					PV_Mode__MPPT_FVoc_Init();
+				}
+			}
 			else { // PV mode setting error
 				// request switching off output next round
 				PV_Mode_CTR = PV_Mode__NONE;
@@ -265,6 +435,10 @@ void LOAD_CTR_MAIN(){
 		CLR__LED_Output_On;			// disable LOAD enabled indicator
 		CLR__Output_On;				// disable PI-CTR output to keep at VOC
 		CLR__SysControl_IV_Meas;	// Clear IV start control
+		if (is_COM_Status_IV_Stream_On) { // end stream of the cancelled IV measurement without points
+			Trans_IV_Point = IV_Data_Points;
+			UART_Stream_IV_Finish();
+		}
 		CLR__SysControl_Trans_Meas;	// clear Transient measurement control
 		PV_Mode_ACT = PV_Mode__NONE;
 		PV_Volt_DAQ_New = DAC_MAX_COUNTS;		// SET DAC to maxV
@@ -462,11 +636,16 @@ bool Check_Temp_Disconnect_State(){
 // Constant Current Control Initialization
 void PV_Mode__Constant_Current_Init(){
 	/* function initializes the constant current mode */
+	float Volt_FF;
+	
 	Track_Status = 0; // reset all of it!
 	PV_Mode_ACT = PV_Mode_CTR;
 	PV_Volt_DAQ_New = 0;
-	SET__Track_Status_Dir_Volt_Up;
-	Track_Volt_Step_Size = AI_Volt_Scale * LOAD_CurrT_Max_Step_CND;
+	// feed forward, start at the voltage of the set-point current on a recent IV curve
+	Volt_FF = LOAD_Get_Feed_Forward_Volt(PV_Curr_Setpoint, 0);
+	if (Volt_FF > 0) PV_Volt_DAQ_New = Volt_FF;
+	Track_PID_Integral = PV_Volt_DAQ_New; // bumpless start of the PID
+	Track_Curr_Old = AI_Curr_Corr;
 		
 }
 
@@ -475,57 +654,60 @@ void PV_Mode__Constant_Current_Init(){
 // Constant Current Control Main
 void PV_Mode__Constant_Current_Main(){
 	/* this is the main function controlling the constant current output
-	- its called once per cycle to regulate current using voltage control
-	- works a bit like the MPPT controller, but regulates specific current instead of max power*/
+	- its called once per cycle to regulate current using voltage control */
+	LOAD_Curr_PID_Update(PV_Curr_Setpoint);
+		
+}
+
+//-------------------------------------------------------------------------------------------
+// Current PID controller update
+void LOAD_Curr_PID_Update(float Curr_Setpoint){
+	/* function regulates the current to the set-point with the voltage set-point, called once per control cycle
+	- discrete PID controller, error in current ADC counts & output in voltage DAC counts of the active ranges
+	- the integral part is kept in volts, so range changes don't cause a bump
+	- the output is clamped between 0V and "Voc" and to the maximum step per cycle
+	- the integral part is not updated while the output is clamped, unless it moves the output back (anti-windup)
+	- errors within the tolerance are treated as zero (no adjust range) */
+	float Err_CND, Prop, Deriv, Integral, Volt_PID, Volt_Out, Volt_Max, Step_Max;
 	
-	// check if reached Voc, reverse if so
-	if (PV_Volt_DAQ_New > (AI_Volt + (AI_Volt_Scale * 500.0))) {
-		PV_Volt_DAQ_New = AI_Volt;
-		CLR__Track_Status_Dir_Volt_Up;
-	}
+	// current too high means voltage too low, positive error increases voltage
+	Err_CND = (AI_Curr_Corr - Curr_Setpoint) / AI_Curr_Scale;
+	if (fabs(Err_CND) < LOAD_CurrT_Tolerance_CND) Err_CND = 0;
+	Prop = LOAD_CurrT_PID_Kp * Err_CND * AI_Volt_Scale;
+	// derivative of the measurement, no kick on set-point changes
+	Deriv = LOAD_CurrT_PID_Kd * ((AI_Curr_Corr - Track_Curr_Old) / AI_Curr_Scale) * AI_Volt_Scale;
+	Track_Curr_Old = AI_Curr_Corr;
+	Integral = Track_PID_Integral + LOAD_CurrT_PID_Ki * Err_CND * AI_Volt_Scale;
+	Volt_PID = Integral + Prop + Deriv;
 	
-	// control voltage dependent on current
-	if(AI_Curr_Corr < (PV_Curr_Setpoint - AI_Curr_Scale * LOAD_CurrT_Tolerance_CND)) {
-		// current too low, voltage too high, reduce voltage
-		PV_Volt_DAQ_New = PV_Volt_DAQ_New - Track_Volt_Step_Size;
-		if (is_Track_Status_Dir_Volt_Up) {
-			CLR__Track_Status_Dir_Volt_Up;
-			Track_Volt_Step_Size = Track_Volt_Step_Size * LOAD_CurrT_Step_Reduction_Fact;
-		}
-		else { // if ya going the correct direction already increase step size...
-			Track_Volt_Step_Size = Track_Volt_Step_Size * LOAD_CurrT_Step_Increase_Fact;
-		}
-	}
-	else if(AI_Curr_Corr > (PV_Curr_Setpoint + AI_Curr_Scale * LOAD_CurrT_Tolerance_CND)){
-		// current too hight, voltage too low, increase voltage
-		PV_Volt_DAQ_New = PV_Volt_DAQ_New + Track_Volt_Step_Size;
-		if (!(is_Track_Status_Dir_Volt_Up)) {
-			SET__Track_Status_Dir_Volt_Up;
-			Track_Volt_Step_Size = Track_Volt_Step_Size * LOAD_CurrT_Step_Reduction_Fact;
-		}
-		else { // if ya going the correct direction already increase step size to get there faster...
-			Track_Volt_Step_Size = Track_Volt_Step_Size * LOAD_CurrT_Step_Increase_Fact;
-		}
-	}
-	else {
-		// do nothing, its within range
-	}
-	// Check Voltage Step Size is in Range
-	if (Track_Volt_Step_Size > (AI_Volt_Scale * LOAD_CurrT_Max_Step_CND)) {
-		Track_Volt_Step_Size = AI_Volt_Scale * LOAD_CurrT_Max_Step_CND;
-	}
-	else if (Track_Volt_Step_Size < (AI_Volt_Scale * LOAD_CurrT_Min_Step_CND)) {
-		Track_Volt_Step_Size = AI_Volt_Scale * LOAD_CurrT_Min_Step_CND;
-	}
+	// clamp output to maximum step & range, don't go far over Voc
+	Volt_Out = Volt_PID;
+	Step_Max = AI_Volt_Scale * LOAD_CurrT_Max_Step_CND;
+	if (Volt_Out > (PV_Volt_DAQ_New + Step_Max)) Volt_Out = PV_Volt_DAQ_New + Step_Max;
+	else if (Volt_Out < (PV_Volt_DAQ_New - Step_Max)) Volt_Out = PV_Volt_DAQ_New - Step_Max;
+	Volt_Max = AI_Volt + (AI_Volt_Scale * 500.0);
+	if (Volt_Out > Volt_Max) Volt_Out = Volt_Max;
+	if (Volt_Out < 0) Volt_Out = 0;
 	
-	// Check Voltage set point is within boundaries
-	if (PV_Volt_DAQ_New < 0){
-		PV_Volt_DAQ_New = 0;
-		SET__Track_Status_Dir_Volt_Up;
+	// anti-windup, integrate only if not clamped or the integral change points back into range
+	if ((Volt_Out == Volt_PID) || (((Integral - Track_PID_Integral) * (Volt_Out - Volt_PID)) > 0)) {
+		Track_PID_Integral = Integral;
 	}
+	PV_Volt_DAQ_New = Volt_Out;
 		
 }
 
+//-------------------------------------------------------------------------------------------
+// Start voltage from last IV curve
+float LOAD_Get_Feed_Forward_Volt(float Curr, float Cond){
+	/* function returns the voltage at which the IV curve in the buffer crosses the load line I = Curr + Cond * V
+	- only if the buffer holds the IV curve of a completed sweep, not older than the feed forward maximum age
+	- returns -1 if there is no such IV curve or no crossing */
+	if ((LOAD_CurrT_FF_Max_Age_s == 0) || !is_IV_Data_Valid_Curve || (IV_Data_Points < MIN_IV_POINTS)) return -1.0;
+	if (((float) (Get_Timer_Main_Ticks() - IV_Curve_Tick) * TIMER_1_TICK_TIME_S) > (float) LOAD_CurrT_FF_Max_Age_s) return -1.0;
+	return get_DAC_Volt_at_Load_Line_from_IV(Curr, Cond);
+}
+
 //-------------------------------------------------------------------------------------------
 // MPPT Tracker Main - the simple one
 void PV_Mode__MPPT_Simple_Init(){
@@ -534,6 +716,7 @@ void PV_Mode__MPPT_Simple_Init(){
 	Track_Power_Old = -1000.0; 
 	PV_Active_Load_Power = -1000.0;
 	LOAD_MPPT_Update_Counter = LOAD_MPPT_Timer_Update_Delay;
+	LOAD_MPPT_Mini_IV_Counter = LOAD_MPPT_Mini_IV_Interval;
 	PV_Mode_ACT = PV_Mode_CTR;
 	// get Voc & set optimal start voltage
 	PV_Volt_DAQ_New = 0.65 * IV_MEAS__Get_Voc_Set_Optimum_Range();
@@ -545,7 +728,17 @@ void PV_Mode__MPPT_Simple_Init(){
 //-------------------------------------------------------------------------------------------
 // MPPT Tracker Main - the simple one
 void PV_Mode__MPPT_Simple_Main(){
-	/* this is the main function that gets the simple hill climber MPPT going */
+	/* this is the main function that gets the simple hill climber MPPT going 
+	- a mini IV sweep around the set-point can be requested by the host or periodically to re-center faster */
+	
+	// periodic mini IV sweep request
+	if (LOAD_MPPT_Mini_IV_Interval > 0) {
+		LOAD_MPPT_Mini_IV_Counter--;
+		if (LOAD_MPPT_Mini_IV_Counter == 0) {
+			LOAD_MPPT_Mini_IV_Counter = LOAD_MPPT_Mini_IV_Interval;
+			SET__Track_Status_Mini_IV_Request;
+		}
+	}
 	
 	LOAD_MPPT_Update_Counter--;
 	
@@ -563,6 +756,13 @@ void PV_Mode__MPPT_Simple_Main(){
 		CLR__Track_Status_new_IV_curve;
 		PV_Volt_DAQ_New = get_DAC_Volt_at_Pmax_from_IV();
 	}
+	else if(is_Track_Status_Mini_IV_Request){
+		// mini IV sweep around set-point, jump to estimated maximum power and continue with fine steps
+		CLR__Track_Status_Mini_IV_Request;
+		PV_Volt_DAQ_New = IV_MEAS__Mini_Sweep_Get_Vmp();
+		Track_Volt_Step_Size = AI_Volt_Scale * LOAD_MPPT_Min_Step_CND;
+		Track_Power_Old = -1000.0;
+	}
 	else { 
 		// normal MPPT, no new IV curves
 		// check if V set reached "Voc", go down if so
@@ -627,4 +827,921 @@ void PV_Mode__MPPT_Simple_Main(){
 		Track_Power_Old = PV_Active_Load_Power; // set new power to old
 	}
 		
-}
\ No newline at end of file
+}
+//-------------------------------------------------------------------------------------------
+// MPPT Tracker Init - incremental conductance
+void PV_Mode__MPPT_IncCond_Init(){
+	/* function initializes the incremental conductance MPPT tracker mode */
+	Track_Status = 0; // reset all of it!
+	LOAD_MPPT_Update_Counter = LOAD_MPPT_Timer_Update_Delay;
+	LOAD_MPPT_Mini_IV_Counter = LOAD_MPPT_Mini_IV_Interval;
+	PV_Mode_ACT = PV_Mode_CTR;
+	// get Voc & set optimal start voltage
+	PV_Volt_DAQ_New = 0.65 * IV_MEAS__Get_Voc_Set_Optimum_Range();
+	SET__Track_Status_Dir_Volt_Up;
+	Track_Volt_Step_Size = AI_Volt_Scale * LOAD_MPPT_Max_Step_CND;
+	// old operating point is measured at Voc, the first step will be taken towards the MPP
+	Track_Volt_Old = AI_Volt;
+	Track_Curr_Old = AI_Curr_Corr;
+	
+}
+
+//-------------------------------------------------------------------------------------------
+// MPPT Tracker Main - incremental conductance
+void PV_Mode__MPPT_IncCond_Main(){
+	/* this is the main function of the incremental conductance MPPT
+	- the MPP is where dP/dV = 0, meaning dI/dV = -I/V, left of it dI/dV > -I/V and right of it dI/dV < -I/V
+	- within the conductance band around the MPP the set-point is held and not perturbed any more
+	- a current change without a voltage change means the irradiance changed, the set-point follows it
+	- mini IV sweeps and new IV curves re-centre the tracker like in the simple MPPT mode */
+	float Delta_Volt;
+	float Delta_Curr;
+	float Cond_Sum;
+	float Cond_Band;
+	int8_t Step_Dir; // 1 = up, -1 = down, 0 = hold
+	
+	// periodic mini IV sweep request
+	if (LOAD_MPPT_Mini_IV_Interval > 0) {
+		LOAD_MPPT_Mini_IV_Counter--;
+		if (LOAD_MPPT_Mini_IV_Counter == 0) {
+			LOAD_MPPT_Mini_IV_Counter = LOAD_MPPT_Mini_IV_Interval;
+			SET__Track_Status_Mini_IV_Request;
+		}
+	}
+	
+	LOAD_MPPT_Update_Counter--;
+	
+	if (LOAD_MPPT_Update_Counter > 0) {
+		return; // if counter not run down don't to anything
+	}
+	// reset counter
+	LOAD_MPPT_Update_Counter = LOAD_MPPT_Timer_Update_Delay;
+	
+	if(is_Track_Status_new_IV_curve){
+		// new IV curve data, set voltage to new voltage at PMAX
+		CLR__Track_Status_new_IV_curve;
+		PV_Volt_DAQ_New = get_DAC_Volt_at_Pmax_from_IV();
+		Track_Volt_Step_Size = AI_Volt_Scale * LOAD_MPPT_Min_Step_CND;
+	}
+	else if(is_Track_Status_Mini_IV_Request){
+		// mini IV sweep around set-point, jump to estimated maximum power and continue with fine steps
+		CLR__Track_Status_Mini_IV_Request;
+		PV_Volt_DAQ_New = IV_MEAS__Mini_Sweep_Get_Vmp();
+		Track_Volt_Step_Size = AI_Volt_Scale * LOAD_MPPT_Min_Step_CND;
+	}
+	else if (PV_Volt_DAQ_New > (AI_Volt + (AI_Volt_Scale * 500.0))) {
+		// Set point too far over PV voltage - likely over VOC, reset & got down
+		PV_Volt_DAQ_New = (AI_Volt * 0.9);
+		CLR__Track_Status_Dir_Volt_Up;
+		Track_Volt_Step_Size = Track_Volt_Step_Size * LOAD_MPPT_Step_Increase_Fact; // increase step size to get there faster
+	}
+	else {
+		// normal MPPT, no new IV curves - compare operating point to the last one
+		Delta_Volt = AI_Volt - Track_Volt_Old;
+		Delta_Curr = AI_Curr_Corr - Track_Curr_Old;
+		
+		if (AI_Volt < (AI_Volt_Scale * LOAD_IncC_Volt_Noise_CND)) {
+			// at or close to Isc, I/V cannot be evaluated, MPP is always at higher voltage
+			Step_Dir = 1;
+		}
+		else if (fabs(Delta_Volt) < (AI_Volt_Scale * LOAD_IncC_Volt_Noise_CND)) {
+			// no voltage change, only a current change indicates a change in irradiance
+			if (Delta_Curr > (AI_Curr_Scale * LOAD_IncC_Curr_Noise_CND)) Step_Dir = 1;
+			else if (Delta_Curr < -(AI_Curr_Scale * LOAD_IncC_Curr_Noise_CND)) Step_Dir = -1;
+			else if (is_Track_Status_IncC_Hold) Step_Dir = 0;
+			// last step was lost in the noise, not a hold at MPP, keep going
+			else if (is_Track_Status_Dir_Volt_Up) Step_Dir = 1;
+			else Step_Dir = -1;
+		}
+		else {
+			// dI/dV + I/V is zero at MPP, positive left and negative right of it
+			Cond_Sum = (Delta_Curr / Delta_Volt) + (AI_Curr_Corr / AI_Volt);
+			Cond_Band = fabs(AI_Curr_Corr / AI_Volt) * LOAD_IncC_Cond_Band;
+			if (Cond_Sum > Cond_Band) Step_Dir = 1;
+			else if (Cond_Sum < -Cond_Band) Step_Dir = -1;
+			else Step_Dir = 0;
+		}
+		
+		// update last operating point
+		Track_Volt_Old = AI_Volt;
+		Track_Curr_Old = AI_Curr_Corr;
+		
+		if (Step_Dir == 0) {
+			// at MPP, hold set-point and be ready for fine steps when it moves
+			SET__Track_Status_IncC_Hold;
+			Track_Volt_Step_Size = Track_Volt_Step_Size * LOAD_MPPT_Step_Reduction_Fact;
+		}
+		else {
+			CLR__Track_Status_IncC_Hold;
+			if ((Step_Dir > 0) == (is_Track_Status_Dir_Volt_Up != 0)) {
+				// same direction as before, MPP still further away
+				Track_Volt_Step_Size = Track_Volt_Step_Size * LOAD_MPPT_Step_Increase_Fact;
+			}
+			else {
+				// direction changed, MPP has been passed
+				Track_Volt_Step_Size = Track_Volt_Step_Size * LOAD_MPPT_Step_Reduction_Fact;
+			}
+			// smaller steps can't be told from noise by the next update
+			if (Track_Volt_Step_Size < (AI_Volt_Scale * LOAD_IncC_Volt_Noise_CND)) {
+				Track_Volt_Step_Size = AI_Volt_Scale * LOAD_IncC_Volt_Noise_CND;
+			}
+			if (Step_Dir > 0) {
+				SET__Track_Status_Dir_Volt_Up;
+				PV_Volt_DAQ_New = PV_Volt_DAQ_New + Track_Volt_Step_Size;
+			}
+			else {
+				CLR__Track_Status_Dir_Volt_Up;
+				PV_Volt_DAQ_New = PV_Volt_DAQ_New - Track_Volt_Step_Size;
+			}
+		}
+	}
+	
+	// Check Voltage Step Size is in Range
+	if (Track_Volt_Step_Size > (AI_Volt_Scale * LOAD_MPPT_Max_Step_CND)) {
+		Track_Volt_Step_Size = AI_Volt_Scale * LOAD_MPPT_Max_Step_CND;
+	}
+	else if (Track_Volt_Step_Size < (AI_Volt_Scale * LOAD_MPPT_Min_Step_CND)) {
+		Track_Volt_Step_Size = AI_Volt_Scale * LOAD_MPPT_Min_Step_CND;
+	}
+	// Check Voltage set point is within boundaries
+	if (PV_Volt_DAQ_New < 0){
+		SET__Track_Status_Dir_Volt_Up;
+		Track_Volt_Step_Size = AI_Volt_Scale * LOAD_MPPT_Max_Step_CND;
+		PV_Volt_DAQ_New = Track_Volt_Step_Size;
+	}
+		
+}
+
+//-------------------------------------------------------------------------------------------
+// MPPT Tracker Init - single diode model prediction
+void PV_Mode__MPPT_Model_Init(){
+	/* function initializes the model based MPPT tracker mode
+	- the single diode model is fitted to the IV curve in the buffer, if there is one
+	- without valid model it starts like the simple MPPT and works as such until an IV curve is measured */
+	float Voc;
+	
+	Track_Status = 0; // reset all of it!
+	Track_Power_Old = -1000.0;
+	PV_Active_Load_Power = -1000.0;
+	Track_Dither_Offset = 0;
+	LOAD_MPPT_Update_Counter = LOAD_MPPT_Timer_Update_Delay;
+	LOAD_MPPT_Mini_IV_Counter = LOAD_MPPT_Mini_IV_Interval;
+	PV_Mode_ACT = PV_Mode_CTR;
+	SET__Track_Status_Dir_Volt_Up;
+	Track_Volt_Step_Size = AI_Volt_Scale * LOAD_MPPT_Max_Step_CND;
+	LOAD_SDM_Fit_From_IV();
+	// get Voc & set start voltage, predicted from Voc if model is valid
+	Voc = IV_MEAS__Get_Voc_Set_Optimum_Range();
+	if (LOAD_SDM_Valid) PV_Volt_DAQ_New = LOAD_SDM_Get_Vmp(Voc, 0.0);
+	else PV_Volt_DAQ_New = 0.65 * Voc;
+	
+}
+
+//-------------------------------------------------------------------------------------------
+// MPPT Tracker Main - single diode model prediction
+void PV_Mode__MPPT_Model_Main(){
+	/* this is the main function of the model based MPPT
+	- the photo current is calculated from the actual operating point and temperature, Vmp is predicted from it
+	- the set-point is driven straight to the prediction, a small P&O dither offset refines it
+	- a new IV curve refits the model */
+	
+	if (is_Track_Status_new_IV_curve) {
+		// new IV curve data, refit & restart the dither
+		CLR__Track_Status_new_IV_curve;
+		Track_Dither_Offset = 0;
+		Track_Power_Old = -1000.0;
+		if (!LOAD_SDM_Fit_From_IV()) {
+			// no model, hill climber continues from the voltage at PMAX
+			PV_Volt_DAQ_New = get_DAC_Volt_at_Pmax_from_IV();
+			return;
+		}
+	}
+	
+	if (!LOAD_SDM_Valid) {
+		// no model, use the hill climber
+		PV_Mode__MPPT_Simple_Main();
+		return;
+	}
+	
+	LOAD_MPPT_Update_Counter--;
+	
+	if (LOAD_MPPT_Update_Counter > 0) {
+		return; // if counter not run down don't to anything
+	}
+	// reset counter
+	LOAD_MPPT_Update_Counter = LOAD_MPPT_Timer_Update_Delay;
+	
+	// dither with minimum step size, change direction if power went down or offset at its limit
+	if (PV_Active_Load_Power < (Track_Power_Old - AI_Volt_Scale * AI_Curr_Scale * LOAD_MPPT_Tolerance_CND)) {
+		if (is_Track_Status_Dir_Volt_Up) CLR__Track_Status_Dir_Volt_Up;
+		else SET__Track_Status_Dir_Volt_Up;
+	}
+	Track_Power_Old = PV_Active_Load_Power;
+	if (is_Track_Status_Dir_Volt_Up) Track_Dither_Offset = Track_Dither_Offset + AI_Volt_Scale * LOAD_MPPT_Min_Step_CND;
+	else Track_Dither_Offset = Track_Dither_Offset - AI_Volt_Scale * LOAD_MPPT_Min_Step_CND;
+	if (Track_Dither_Offset > (AI_Volt_Scale * LOAD_MPPT_Max_Step_CND)) {
+		Track_Dither_Offset = AI_Volt_Scale * LOAD_MPPT_Max_Step_CND;
+		CLR__Track_Status_Dir_Volt_Up;
+	}
+	else if (Track_Dither_Offset < -(AI_Volt_Scale * LOAD_MPPT_Max_Step_CND)) {
+		Track_Dither_Offset = -(AI_Volt_Scale * LOAD_MPPT_Max_Step_CND);
+		SET__Track_Status_Dir_Volt_Up;
+	}
+	
+	// set-point from prediction and dither
+	PV_Volt_DAQ_New = LOAD_SDM_Get_Vmp(AI_Volt, AI_Curr_Corr) + Track_Dither_Offset;
+	if (PV_Volt_DAQ_New < 0) PV_Volt_DAQ_New = 0;
+	
+}
+
+//-------------------------------------------------------------------------------------------
+// Fit single diode model to the IV curve in the buffer
+bool LOAD_SDM_Fit_From_IV(){
+	/* function extracts the single diode model parameters from the IV curve data (Phang's explicit method)
+	- Isc and shunt conductance from a line fit of the points close to short circuit
+	- Voc and the series resistance at Voc from a line fit of the points close to open circuit
+	- Vmp and Imp from the measured maximum power point
+	- the modified ideality factor, saturation current, series resistance and photo current follow from those
+	- returns false and invalidates the model if the buffer holds no valid IV curve or it does not give sensible parameters */
+	float Volt, Curr, P, Pmax, Vmax, Vmp, Imp;
+	float C0, C1, Isc, Voc, Rs0, Isc_Voc, X, A, I0, Rs;
+	uint8_t i;
+	
+	LOAD_SDM_Valid = false;
+	if (!is_IV_Data_Valid_Curve || (IV_Data_Points < MIN_IV_POINTS)) return false;
+	
+	// max voltage & max power point
+	Vmax = 0;
+	Pmax = 0;
+	Vmp = 0;
+	Imp = 0;
+	for (i=0; i < IV_Data_Points; i++) {
+		Volt = PV_IV_Voltage[i];
+		Curr = PV_IV_Current[i];
+		if (Volt > Vmax) Vmax = Volt;
+		P = Volt * Curr;
+		if (P > Pmax) {
+			Pmax = P;
+			Vmp = Volt;
+			Imp = Curr;
+		}
+	}
+	if (Pmax <= 0) return false;
+	
+	// Isc & shunt conductance
+	if (!LOAD_SDM_Line_Fit(-Vmax, LOAD_SDM_ISC_REGION * Vmax, &C0, &C1)) return false;
+	Isc = C0;
+	LOAD_SDM_Gsh = -C1;
+	if (LOAD_SDM_Gsh < 0) LOAD_SDM_Gsh = 0;
+	
+	// Voc & series resistance at Voc
+	if (!LOAD_SDM_Line_Fit(LOAD_SDM_VOC_REGION * Vmax, Vmax, &C0, &C1)) return false;
+	if (C1 >= 0) return false;
+	Voc = -C0 / C1;
+	Rs0 = -1.0 / C1;
+	
+	// explicit extraction
+	Isc_Voc = Isc - Voc * LOAD_SDM_Gsh;
+	X = Isc - Vmp * LOAD_SDM_Gsh - Imp;
+	if ((X <= 0) || (Isc_Voc <= 0) || (Voc <= Vmp)) return false;
+	A = (Vmp + Rs0 * Imp - Voc) / (log(X) - log(Isc_Voc) + Imp / Isc_Voc);
+	if (!(A > 0)) return false;
+	I0 = Isc_Voc * exp(-Voc / A);
+	if (!(I0 > 0)) return false;
+	Rs = Rs0 - A / Isc_Voc;
+	if (Rs < 0) Rs = 0;
+	
+	LOAD_SDM_A = A;
+	LOAD_SDM_I0 = I0;
+	LOAD_SDM_Rs = Rs;
+	LOAD_SDM_Iph = Isc * (1.0 + Rs * LOAD_SDM_Gsh) + I0 * (exp(Isc * Rs / A) - 1.0);
+	LOAD_SDM_T_Fit_K = LOAD_SDM_Get_Temp_K();
+	if (LOAD_SDM_T_Fit_K == 0) LOAD_SDM_T_Fit_K = LOAD_SDM_T_REF_K;
+	LOAD_SDM_Vd_Mp = Vmp + Imp * Rs;
+	LOAD_SDM_Vmp = Vmp;
+	LOAD_SDM_Valid = true;
+	return true;
+}
+
+//-------------------------------------------------------------------------------------------
+// Least squares line fit I = C0 + C1*V of the IV points within a voltage window
+bool LOAD_SDM_Line_Fit(float Volt_Low, float Volt_High, float *C0, float *C1){
+	/* returns false if there are less than 2 points in the window or all at the same voltage */
+	float Sx, Sy, Sxx, Sxy, N, Det;
+	uint8_t i;
+	
+	Sx = 0; Sy = 0; Sxx = 0; Sxy = 0; N = 0;
+	for (i=0; i < IV_Data_Points; i++) {
+		if ((PV_IV_Voltage[i] >= Volt_Low) && (PV_IV_Voltage[i] <= Volt_High)) {
+			Sx = Sx + PV_IV_Voltage[i];
+			Sy = Sy + PV_IV_Current[i];
+			Sxx = Sxx + PV_IV_Voltage[i] * PV_IV_Voltage[i];
+			Sxy = Sxy + PV_IV_Voltage[i] * PV_IV_Current[i];
+			N = N + 1.0;
+		}
+	}
+	if (N < 2.0) return false;
+	Det = N * Sxx - Sx * Sx;
+	if (Det <= 0) return false;
+	*C1 = (N * Sxy - Sx * Sy) / Det;
+	*C0 = (Sy - *C1 * Sx) / N;
+	return true;
+}
+
+//-------------------------------------------------------------------------------------------
+// device temperature for the single diode model
+float LOAD_SDM_Get_Temp_K(){
+	/* returns the RTD temperature in Kelvin, or 0 if the RTD is off or out of range */
+	if (is_SysConfig_TEMP_On && (AI_RTD_Temp > LOAD_SDM_T_MIN_C) && (AI_RTD_Temp < LOAD_SDM_T_MAX_C)) {
+		return AI_RTD_Temp + 273.15;
+	}
+	return 0;
+}
+
+//-------------------------------------------------------------------------------------------
+// predict Vmp from the single diode model
+float LOAD_SDM_Get_Vmp(float Volt, float Curr){
+	/* function predicts the voltage at maximum power for the actual conditions
+	- saturation current & ideality factor are corrected to the actual RTD temperature
+	- the photo current is calculated from the operating point (Volt, Curr), it follows the irradiance
+	- the power is maximised over the diode voltage Vd, V = Vd - I*Rs and I = Iph - I0*(exp(Vd/A)-1) - Vd*Gsh are explicit in it
+	- safeguarded Newton search on dP/dVd, started from the last result */
+	float T_K, Ratio, A, I0, Iph, Vd, Vd_New, Lo, Hi;
+	float Ex, I, V, G, Gd, D1, D2;
+	uint8_t i;
+	
+	// temperature correction
+	T_K = LOAD_SDM_Get_Temp_K();
+	if (T_K == 0) T_K = LOAD_SDM_T_Fit_K;
+	Ratio = T_K / LOAD_SDM_T_Fit_K;
+	A = LOAD_SDM_A * Ratio;
+	I0 = LOAD_SDM_I0 * Ratio * Ratio * Ratio * exp(LOAD_SDM_EG_K * (1.0 / LOAD_SDM_T_Fit_K - 1.0 / T_K));
+	
+	// photo current from operating point
+	Vd = Volt + Curr * LOAD_SDM_Rs;
+	Iph = Curr + I0 * (exp(Vd / A) - 1.0) + Vd * LOAD_SDM_Gsh;
+	if (Iph <= 0) return LOAD_SDM_Vmp;
+	LOAD_SDM_Iph = Iph;
+	
+	// search bracket from short circuit to open circuit diode voltage (without shunt)
+	Lo = 0;
+	Hi = A * log(Iph / I0 + 1.0);
+	Vd = LOAD_SDM_Vd_Mp;
+	if ((Vd <= Lo) || (Vd >= Hi)) Vd = 0.5 * (Lo + Hi);
+	for (i=0; i < LOAD_SDM_NEWTON_MAX; i++) {
+		Ex = exp(Vd / A);
+		I = Iph - I0 * (Ex - 1.0) - Vd * LOAD_SDM_Gsh;
+		V = Vd - I * LOAD_SDM_Rs;
+		Gd = I0 * Ex / A;			// diode conductance
+		G = Gd + LOAD_SDM_Gsh;		// -dI/dVd
+		D1 = (1.0 + LOAD_SDM_Rs * G) * I - V * G;	// dP/dVd
+		D2 = LOAD_SDM_Rs * Gd / A * I - 2.0 * G * (1.0 + LOAD_SDM_Rs * G) - V * Gd / A;	// d2P/dVd2
+		if (D1 > 0) Lo = Vd;
+		else Hi = Vd;
+		// Newton step, bisection if it leaves the bracket
+		if (D2 < 0) Vd_New = Vd - D1 / D2;
+		else Vd_New = Lo;
+		if ((Vd_New <= Lo) || (Vd_New >= Hi)) Vd_New = 0.5 * (Lo + Hi);
+		if (fabs(Vd_New - Vd) < (LOAD_SDM_NEWTON_TOL * A)) {
+			Vd = Vd_New;
+			break;
+		}
+		Vd = Vd_New;
+	}
+	LOAD_SDM_Vd_Mp = Vd;
+	I = Iph - I0 * (exp(Vd / A) - 1.0) - Vd * LOAD_SDM_Gsh;
+	LOAD_SDM_Vmp = Vd - I * LOAD_SDM_Rs;
+	return LOAD_SDM_Vmp;
+}
+
+//-------------------------------------------------------------------------------------------
+// MPPT Tracker Init - golden section search
+void PV_Mode__MPPT_Golden_Init(){
+	/* function initializes the golden section search MPPT, bracket from Voc fractions */
+	float Voc;
+	
+	Track_Status = 0; // reset all of it!
+	LOAD_MPPT_Update_Counter = LOAD_MPPT_Timer_Update_Delay;
+	PV_Mode_ACT = PV_Mode_CTR;
+	Voc = IV_MEAS__Get_Voc_Set_Optimum_Range();
+	LOAD_GSS_Start(LOAD_GSS_Low_Voc_Fact * Voc, LOAD_GSS_High_Voc_Fact * Voc);
+	
+}
+
+//-------------------------------------------------------------------------------------------
+// MPPT Tracker Main - golden section search
+void PV_Mode__MPPT_Golden_Main(){
+	/* this is the main function of the golden section search MPPT
+	- each update measures the power of one inner point of the bracket and narrows it by the golden ratio
+	- when the bracket is smaller than the minimum MPPT step the set-point is held in its centre
+	- if the power then drifts by more than the drift fraction the search restarts from Voc fractions
+	- a new IV curve restarts the search with the IV points around its PMAX as bracket */
+	float Voc, Drift_Max;
+	
+	if (is_Track_Status_new_IV_curve) {
+		CLR__Track_Status_new_IV_curve;
+		LOAD_GSS_Start_From_IV();
+		LOAD_MPPT_Update_Counter = LOAD_MPPT_Timer_Update_Delay;
+		return;
+	}
+	
+	LOAD_MPPT_Update_Counter--;
+	
+	if (LOAD_MPPT_Update_Counter > 0) {
+		return; // if counter not run down don't to anything
+	}
+	// reset counter
+	LOAD_MPPT_Update_Counter = LOAD_MPPT_Timer_Update_Delay;
+	
+	// power of the last set-point ...!!!....  done at start of Load Control function
+	if (Track_GSS_State == LOAD_GSS__X1_FIRST) {
+		Track_GSS_P1 = PV_Active_Load_Power;
+		Track_GSS_State = LOAD_GSS__X2;
+		PV_Volt_DAQ_New = Track_GSS_X2;
+	}
+	else if (Track_GSS_State == LOAD_GSS__X2) {
+		Track_GSS_P2 = PV_Active_Load_Power;
+		LOAD_GSS_Narrow();
+	}
+	else if (Track_GSS_State == LOAD_GSS__X1) {
+		Track_GSS_P1 = PV_Active_Load_Power;
+		LOAD_GSS_Narrow();
+	}
+	else if (Track_GSS_State == LOAD_GSS__HOLD_REF) {
+		Track_GSS_P_Hold = PV_Active_Load_Power;
+		Track_GSS_State = LOAD_GSS__HOLD;
+	}
+	else {
+		// holding, restart if power drifted off, not within the MPPT power noise tolerance
+		Drift_Max = fabs(Track_GSS_P_Hold) * LOAD_GSS_Drift_Fact;
+		if (Drift_Max < (AI_Volt_Scale * AI_Curr_Scale * LOAD_MPPT_Tolerance_CND)) Drift_Max = AI_Volt_Scale * AI_Curr_Scale * LOAD_MPPT_Tolerance_CND;
+		if (fabs(PV_Active_Load_Power - Track_GSS_P_Hold) > Drift_Max) {
+			Voc = IV_MEAS__Get_Voc_Set_Optimum_Range();
+			LOAD_GSS_Start(LOAD_GSS_Low_Voc_Fact * Voc, LOAD_GSS_High_Voc_Fact * Voc);
+		}
+	}
+	
+}
+
+//-------------------------------------------------------------------------------------------
+// start golden section search with new bracket
+void LOAD_GSS_Start(float Volt_Low, float Volt_High){
+	/* function sets the bracket & both inner points, and sets the DAC to the lower inner point */
+	if (Volt_Low < 0) Volt_Low = 0;
+	if (Volt_High < Volt_Low) Volt_High = Volt_Low;
+	Track_GSS_Low = Volt_Low;
+	Track_GSS_High = Volt_High;
+	Track_GSS_X1 = Volt_High - LOAD_GSS_RATIO * (Volt_High - Volt_Low);
+	Track_GSS_X2 = Volt_Low + LOAD_GSS_RATIO * (Volt_High - Volt_Low);
+	Track_GSS_State = LOAD_GSS__X1_FIRST;
+	PV_Volt_DAQ_New = Track_GSS_X1;
+}
+
+//-------------------------------------------------------------------------------------------
+// start golden section search with bracket from IV curve
+void LOAD_GSS_Start_From_IV(){
+	/* the bracket are the next IV points below and above the one at PMAX
+	- IV data may be in any order (reverse, hysteresis sweeps), so all points are searched */
+	float Vmp, Volt, Volt_Low, Volt_High;
+	bool Found_Low, Found_High;
+	uint8_t i;
+	
+	Vmp = get_DAC_Volt_at_Pmax_from_IV();
+	if (Vmp <= 0) {
+		// no power in IV data, start from Voc fractions
+		Vmp = IV_MEAS__Get_Voc_Set_Optimum_Range();
+		LOAD_GSS_Start(LOAD_GSS_Low_Voc_Fact * Vmp, LOAD_GSS_High_Voc_Fact * Vmp);
+		return;
+	}
+	Volt_Low = Vmp * (1.0 - LOAD_GSS_IV_WIDEN);
+	Volt_High = Vmp * (1.0 + LOAD_GSS_IV_WIDEN);
+	Found_Low = false;
+	Found_High = false;
+	for (i=0; i < IV_Data_Points; i++) {
+		Volt = PV_IV_Voltage[i];
+		if ((Volt > Vmp) && (!Found_High || (Volt < Volt_High))) {
+			Volt_High = Volt;
+			Found_High = true;
+		}
+		else if ((Volt < Vmp) && (!Found_Low || (Volt > Volt_Low))) {
+			Volt_Low = Volt;
+			Found_Low = true;
+		}
+	}
+	LOAD_GSS_Start(Volt_Low, Volt_High);
+}
+
+//-------------------------------------------------------------------------------------------
+// narrow golden section bracket
+void LOAD_GSS_Narrow(){
+	/* function drops the side of the bracket beyond the inner point with less power and sets the next inner point
+	- the kept inner point becomes the other inner point, only one new point has to be measured per update */
+	if ((Track_GSS_High - Track_GSS_Low) < (AI_Volt_Scale * LOAD_MPPT_Min_Step_CND)) {
+		// converged, hold in the centre
+		PV_Volt_DAQ_New = 0.5 * (Track_GSS_Low + Track_GSS_High);
+		Track_GSS_State = LOAD_GSS__HOLD_REF;
+		return;
+	}
+	if (Track_GSS_P1 > Track_GSS_P2) {
+		// PMAX below upper inner point
+		Track_GSS_High = Track_GSS_X2;
+		Track_GSS_X2 = Track_GSS_X1;
+		Track_GSS_P2 = Track_GSS_P1;
+		Track_GSS_X1 = Track_GSS_High - LOAD_GSS_RATIO * (Track_GSS_High - Track_GSS_Low);
+		Track_GSS_State = LOAD_GSS__X1;
+		PV_Volt_DAQ_New = Track_GSS_X1;
+	}
+	else {
+		// PMAX above lower inner point
+		Track_GSS_Low = Track_GSS_X1;
+		Track_GSS_X1 = Track_GSS_X2;
+		Track_GSS_P1 = Track_GSS_P2;
+		Track_GSS_X2 = Track_GSS_Low + LOAD_GSS_RATIO * (Track_GSS_High - Track_GSS_Low);
+		Track_GSS_State = LOAD_GSS__X2;
+		PV_Volt_DAQ_New = Track_GSS_X2;
+	}
+}
+
+//-------------------------------------------------------------------------------------------
+// MPPT Tracker Init - fractional Voc
+void PV_Mode__MPPT_FVoc_Init(){
+	/* function initializes the fractional Voc MPPT with a first Voc sample */
+	
+	Track_Status = 0; // reset all of it!
+	PV_Mode_ACT = PV_Mode_CTR;
+	LOAD_FVoc_Calibrate_From_IV();
+	LOAD_FVoc_Sample();
+	
+}
+
+//-------------------------------------------------------------------------------------------
+// MPPT Tracker Main - fractional Voc
+void PV_Mode__MPPT_FVoc_Main(){
+	/* this is the main function of the fractional Voc MPPT
+	- the set-point is held at the factor times the last Voc, no perturbation in between
+	- Voc is sampled every interval by opening the load for the settle time
+	- with auto-calibration a new IV curve updates the factor to its Vmp/Voc */
+	
+	if (is_Track_Status_new_IV_curve) {
+		CLR__Track_Status_new_IV_curve;
+		LOAD_FVoc_Calibrate_From_IV();
+		PV_Volt_DAQ_New = LOAD_FVoc_Fact_Act * LOAD_FVoc_Voc;
+	}
+	
+	LOAD_FVoc_Counter--;
+	
+	if (LOAD_FVoc_Counter > 0) {
+		return; // if counter not run down don't to anything
+	}
+	LOAD_FVoc_Sample();
+	
+}
+
+//-------------------------------------------------------------------------------------------
+// calibrate fractional Voc factor from IV curve
+void LOAD_FVoc_Calibrate_From_IV(){
+	/* function sets the active factor, the fixed one or Vmp/Voc of the IV curve in the buffer if auto-calibrated
+	- Voc of the IV curve is where it crosses zero current, the default factor is kept if it has none or is implausible
+	- transient data or an aborted sweep in the buffer are no IV curve to calibrate from */
+	float Vmp, Voc, Fact;
+	
+	if (LOAD_FVoc_Fact > 0) {
+		LOAD_FVoc_Fact_Act = LOAD_FVoc_Fact;
+		return;
+	}
+	if (LOAD_FVoc_Fact_Act <= 0) LOAD_FVoc_Fact_Act = LOAD_FVOC_FACT_DEFAULT;
+	if (!is_IV_Data_Valid_Curve || (IV_Data_Points < MIN_IV_POINTS)) return;
+	Vmp = get_DAC_Volt_at_Pmax_from_IV();
+	Voc = get_DAC_Volt_at_Load_Line_from_IV(0, 0);
+	if ((Vmp <= 0) || (Voc <= 0)) return;
+	Fact = Vmp / Voc;
+	if ((Fact >= LOAD_FVOC_FACT_MIN) && (Fact <= LOAD_FVOC_FACT_MAX)) LOAD_FVoc_Fact_Act = Fact;
+}
+
+//-------------------------------------------------------------------------------------------
+// sample Voc & set fractional Voc set-point
+void LOAD_FVoc_Sample(){
+	/* function measures Voc with the load open for the settle time and sets the set-point to the factor times Voc */
+	LOAD_FVoc_Counter = LOAD_FVoc_Interval;
+	if (LOAD_FVoc_Counter == 0) LOAD_FVoc_Counter = 1;
+	LOAD_FVoc_Voc = IV_MEAS__Get_Voc_Fast(LOAD_FVoc_Settle_ms);
+	PV_Volt_DAQ_New = LOAD_FVoc_Fact_Act * LOAD_FVoc_Voc;
+}
+
+//-------------------------------------------------------------------------------------------
+// Start set-point profile
+bool LOAD_Profile_Start(){
+	/* function starts the set-point profile from the first step, returns false if there are no steps */
+	uint8_t i;
+	
+	if ((LOAD_Prof_Count == 0) || (LOAD_Prof_Count > LOAD_PROF_MAX_STEPS)) return false;
+	for (i=0; i < LOAD_PROF_MAX_STEPS; i++) {
+		LOAD_Prof_Repeat_Left[i] = LOAD_Prof_Repeat[i];
+	}
+	LOAD_Prof_Step = 0;
+	LOAD_Prof_Tick_Start = Get_Timer_Main_Ticks();
+	LOAD_Prof_State = LOAD_PROF__RUN;
+	LOAD_Profile_Apply_Step();
+	return true;
+}
+
+//-------------------------------------------------------------------------------------------
+// Stop set-point profile
+void LOAD_Profile_Stop(){
+	/* function stops the set-point profile, the load stays in the mode of the active step */
+	LOAD_Prof_State = LOAD_PROF__STOP;
+}
+
+//-------------------------------------------------------------------------------------------
+// Pause set-point profile
+void LOAD_Profile_Pause(){
+	/* function holds the step time, the load stays in the mode of the active step */
+	if (LOAD_Prof_State != LOAD_PROF__RUN) return;
+	LOAD_Prof_Tick_Paused = Get_Timer_Main_Ticks() - LOAD_Prof_Tick_Start;
+	LOAD_Prof_State = LOAD_PROF__PAUSE;
+}
+
+//-------------------------------------------------------------------------------------------
+// Resume set-point profile
+void LOAD_Profile_Resume(){
+	/* function continues the step time where it was paused */
+	if (LOAD_Prof_State != LOAD_PROF__PAUSE) return;
+	LOAD_Prof_Tick_Start = Get_Timer_Main_Ticks() - LOAD_Prof_Tick_Paused;
+	LOAD_Prof_State = LOAD_PROF__RUN;
+}
+
+//-------------------------------------------------------------------------------------------
+// Process set-point profile
+void LOAD_Profile_Process(){
+	/* function moves on to the next profile step when the active step has run its duration, called every control cycle while the output is on
+	- the step time runs on the main timer, also while the output is off, only pausing holds it */
+	if (LOAD_Prof_State != LOAD_PROF__RUN) return;
+	if (LOAD_Profile_Get_Elapsed_s() >= (float) LOAD_Prof_Duration_s[LOAD_Prof_Step]) {
+		LOAD_Profile_Next_Step(true);
+	}
+}
+
+//-------------------------------------------------------------------------------------------
+// Next set-point profile step
+void LOAD_Profile_Next_Step(bool Keep_Cadence){
+	/* function ends the active step and applies the next one
+	- if the step has repeats left, the profile returns to the first step, otherwise it continues with the next step
+	- after the last step the profile stops and the load stays in the mode of the last step
+	- with cadence kept the next step starts when the last one was due, so step times don't add up control cycle delays
+		- devices started together stay synchronised
+		- if the profile has fallen behind by more than the next step, e.g. while the output was off, the step starts now
+		  so missed steps are not replayed one per control cycle */
+	uint8_t i;
+	uint32_t Tick_Act;
+	
+	i = LOAD_Prof_Step;
+	if ((LOAD_Prof_Repeat[i] == LOAD_PROF_REPEAT_ENDLESS) || (LOAD_Prof_Repeat_Left[i] > 0)) {
+		if (LOAD_Prof_Repeat[i] != LOAD_PROF_REPEAT_ENDLESS) LOAD_Prof_Repeat_Left[i]--;
+		LOAD_Prof_Step = 0;
+	}
+	else {
+		LOAD_Prof_Repeat_Left[i] = LOAD_Prof_Repeat[i]; // reload for the next round of an outer repeat
+		if ((LOAD_Prof_Step + 1) >= LOAD_Prof_Count) {
+			// profile finished
+			LOAD_Prof_State = LOAD_PROF__STOP;
+			return;
+		}
+		LOAD_Prof_Step++;
+	}
+	Tick_Act = Get_Timer_Main_Ticks();
+	if (Keep_Cadence) {
+		LOAD_Prof_Tick_Start = LOAD_Prof_Tick_Start + (uint32_t) ((float) LOAD_Prof_Duration_s[i] / TIMER_1_TICK_TIME_S);
+		if ((float) (Tick_Act - LOAD_Prof_Tick_Start) * TIMER_1_TICK_TIME_S >= (float) LOAD_Prof_Duration_s[LOAD_Prof_Step]) LOAD_Prof_Tick_Start = Tick_Act;
+	}
+	else LOAD_Prof_Tick_Start = Tick_Act;
+	if (LOAD_Prof_State == LOAD_PROF__PAUSE) LOAD_Prof_Tick_Paused = 0;
+	LOAD_Profile_Apply_Step();
+}
+
+//-------------------------------------------------------------------------------------------
+// Apply set-point profile step
+void LOAD_Profile_Apply_Step(){
+	/* function sets the load mode & the set-point of the active step
+	- the set-point is applied to the set-point variable of the mode, it is not used in all other modes
+	- the load mode changes as if written by LOAD:MODE, the mode initialises only if it is a different one
+	- a step with an invalid load mode stops the profile with error state, instead of switching the output off */
+	uint8_t Mode;
+	float Setpoint;
+	
+	Mode = LOAD_Prof_Mode[LOAD_Prof_Step];
+	if (Mode > PV_Mode__MAX_ID) {
+		LOAD_Prof_State = LOAD_PROF__ERROR;
+		return;
+	}
+	Setpoint = LOAD_Prof_Setpoint[LOAD_Prof_Step];
+	if (Mode == PV_Mode__Const_Volt) PV_Volt_Setpoint = Setpoint;
+	else if (Mode == PV_Mode__Const_Curr) PV_Curr_Setpoint = Setpoint;
+	else if (Mode == PV_Mode__Const_Power) {
+		if (Setpoint < 0) Setpoint = 0;
+		PV_Pow_Setpoint = Setpoint;
+	}
+	else if (Mode == PV_Mode__Const_Res) {
+		if (Setpoint < 0) Setpoint = 0;
+		PV_Res_Setpoint = Setpoint;
+	}
+	PV_Mode_CTR = Mode;
+}
+
+//-------------------------------------------------------------------------------------------
+// Elapsed time of set-point profile step
+float LOAD_Profile_Get_Elapsed_s(){
+	/* function returns the time the active step has run in [s], 0 if the profile is stopped */
+	uint32_t Ticks;
+	
+	if (LOAD_Prof_State == LOAD_PROF__RUN) Ticks = Get_Timer_Main_Ticks() - LOAD_Prof_Tick_Start;
+	else if (LOAD_Prof_State == LOAD_PROF__PAUSE) Ticks = LOAD_Prof_Tick_Paused;
+	else return 0;
+	return (float) Ticks * TIMER_1_TICK_TIME_S;
+}
+
+//-------------------------------------------------------------------------------------------
+// Integrate energy accumulators
+void LOAD_Energy_Process(){
+	/* function integrates the load power, the current & the power available at Pmp of the last IV curve, called every control cycle
+	- the time since the last call is used, time blocked by IV sweeps, mini IV sweeps & Voc samples gets the energy delivered meanwhile
+		- only the remaining time is integrated with the actual power, transient measurements & Voc searches at mode start are part of it
+	- the charge & the energy at Pmp are integrated over the whole time
+	- accumulators are 64 bit integer in nano units, so small increments are not lost in long totals
+	- the active load mode gets the increments, NONE while the output is off
+	- the tracking efficiency is the energy delivered over the energy at Pmp, both only while Pmp is known
+		- Pmp is taken from valid IV curves only & expires after the maximum age, measure IV curves regularly, e.g. with IV:SCHED */
+	uint32_t Tick_Act, Ticks, Block_Ticks;
+	float Time_s, Block_Power_Ticks;
+	int64_t Energy, Charge, Energy_Pmp;
+	uint8_t Mode;
+	
+	Tick_Act = Get_Timer_Main_Ticks();
+	// time & energy of IV measurements since last call
+	Block_Ticks = IV_Block_Ticks;
+	Block_Power_Ticks = IV_Block_Power_Ticks;
+	IV_Block_Ticks = 0;
+	IV_Block_Power_Ticks = 0;
+	if (!LOAD_Energy_Started) {
+		LOAD_Energy_Tick_Last = Tick_Act;
+		LOAD_Energy_Started = true;
+		return;
+	}
+	Ticks = Tick_Act - LOAD_Energy_Tick_Last;
+	Time_s = (float) Ticks * TIMER_1_TICK_TIME_S;
+	LOAD_Energy_Tick_Last = Tick_Act;
+	if (Block_Ticks > Ticks) Block_Ticks = Ticks;
+	
+	// Pmp reference of a new IV curve, an aborted sweep keeps the last one
+	if (LOAD_Energy_IV_Count != IV_Curve_Count) {
+		LOAD_Energy_IV_Count = IV_Curve_Count;
+		if (is_IV_Data_Valid_Curve && (IV_Data_Points >= MIN_IV_POINTS)) {
+			LOAD_Energy_Pmp = get_Pmax_from_IV_Section(0, IV_Data_Points);
+			LOAD_Energy_Pmp_Tick = IV_Curve_Tick;
+		}
+	}
+	// Pmp reference expired
+	if ((LOAD_Energy_Pmp > 0) && (((float) (Tick_Act - LOAD_Energy_Pmp_Tick) * TIMER_1_TICK_TIME_S) > LOAD_ENERGY_PMP_MAX_AGE_S)) LOAD_Energy_Pmp = 0;
+	
+	Mode = PV_Mode_ACT;
+	if (Mode >= LOAD_ENERGY_MODES) Mode = PV_Mode__NONE;
+	Energy = (int64_t) ((PV_Active_Load_Power * (float) (Ticks - Block_Ticks) + Block_Power_Ticks) * TIMER_1_TICK_TIME_S * LOAD_ENERGY_SCALE);
+	Charge = (int64_t) (AI_Curr_Corr * Time_s * LOAD_ENERGY_SCALE);
+	LOAD_Energy_Tot_nWs[Mode] = LOAD_Energy_Tot_nWs[Mode] + Energy;
+	LOAD_Energy_Rst_nWs[Mode] = LOAD_Energy_Rst_nWs[Mode] + Energy;
+	LOAD_Charge_Tot_nAs[Mode] = LOAD_Charge_Tot_nAs[Mode] + Charge;
+	LOAD_Charge_Rst_nAs[Mode] = LOAD_Charge_Rst_nAs[Mode] + Charge;
+	if (LOAD_Energy_Pmp > 0) {
+		Energy_Pmp = (int64_t) (LOAD_Energy_Pmp * Time_s * LOAD_ENERGY_SCALE);
+		LOAD_Energy_Ref_Tot_nWs[Mode] = LOAD_Energy_Ref_Tot_nWs[Mode] + Energy;
+		LOAD_Energy_Ref_Rst_nWs[Mode] = LOAD_Energy_Ref_Rst_nWs[Mode] + Energy;
+		LOAD_Energy_Pmp_Tot_nWs[Mode] = LOAD_Energy_Pmp_Tot_nWs[Mode] + Energy_Pmp;
+		LOAD_Energy_Pmp_Rst_nWs[Mode] = LOAD_Energy_Pmp_Rst_nWs[Mode] + Energy_Pmp;
+	}
+}
+
+//-------------------------------------------------------------------------------------------
+// Reset energy accumulators
+void LOAD_Energy_Reset(){
+	/* function clears the since reset accumulators of all load modes, the totals since start-up are kept */
+	uint8_t i;
+	
+	for (i=0; i < LOAD_ENERGY_MODES; i++) {
+		LOAD_Energy_Rst_nWs[i] = 0;
+		LOAD_Charge_Rst_nAs[i] = 0;
+		LOAD_Energy_Ref_Rst_nWs[i] = 0;
+		LOAD_Energy_Pmp_Rst_nWs[i] = 0;
+	}
+}
+
+//-------------------------------------------------------------------------------------------
+// Sum of energy accumulator
+int64_t LOAD_Energy_Sum(volatile int64_t *Acc){
+	/* function returns the accumulator of the selected load mode, or the sum of all load modes */
+	int64_t Sum;
+	uint8_t i;
+	
+	if (LOAD_Energy_Select < LOAD_ENERGY_MODES) return Acc[LOAD_Energy_Select];
+	Sum = 0;
+	for (i=0; i < LOAD_ENERGY_MODES; i++) {
+		Sum = Sum + Acc[i];
+	}
+	return Sum;
+}
+
+//-------------------------------------------------------------------------------------------
+// Constant Power Control Init
+void PV_Mode__Constant_Power_Init(){
+	/* function initializes the constant power mode
+	- Voc side starts at Voc and lowers the voltage, Isc side starts at 0V and raises it
+	- Vmp of the IV curve in the buffer is used as limit between the two sides
+	- without a valid IV curve (transient data, aborted sweep) there is no limit until the next IV curve */
+	float Voc;
+	
+	Track_Status = 0; // reset all of it!
+	PV_Mode_ACT = PV_Mode_CTR;
+	if (is_IV_Data_Valid_Curve && (IV_Data_Points >= MIN_IV_POINTS)) LOAD_Pow_Volt_Limit = get_DAC_Volt_at_Pmax_from_IV();
+	else LOAD_Pow_Volt_Limit = 0;
+	if (LOAD_Pow_Isc_Side) {
+		PV_Volt_DAQ_New = 0;
+	}
+	else {
+		Voc = IV_MEAS__Get_Voc_Set_Optimum_Range();
+		PV_Volt_DAQ_New = Voc;
+	}
+	Track_PID_Integral = PV_Volt_DAQ_New;
+	Track_Curr_Old = AI_Curr_Corr;
+	
+}
+
+//-------------------------------------------------------------------------------------------
+// Constant Power Control Main
+void PV_Mode__Constant_Power_Main(){
+	/* this is the main function controlling the constant power output, called once per cycle
+	- Voc side: the current PID regulates to the current of the power set-point at the actual voltage
+		- the current falls steeply with voltage here, which the current controller handles well
+	- Isc side: the voltage is set to the power set-point divided by the actual current, limited to the maximum step
+		- the current hardly changes with voltage here, so this converges within a few cycles
+	- if the set-point is above Pmp the load stops at Vmp of the last IV curve */
+	float Volt_Set, Step_Max;
+	
+	if (is_Track_Status_new_IV_curve) {
+		// new IV curve data, new limit
+		CLR__Track_Status_new_IV_curve;
+		if (is_IV_Data_Valid_Curve) LOAD_Pow_Volt_Limit = get_DAC_Volt_at_Pmax_from_IV();
+	}
+	
+	if (LOAD_Pow_Isc_Side) {
+		if (AI_Curr_Corr > (AI_Curr_Scale * LOAD_CurrT_Tolerance_CND)) Volt_Set = PV_Pow_Setpoint / AI_Curr_Corr;
+		else Volt_Set = PV_Volt_DAQ_New; // no current to calculate from, hold
+		Step_Max = AI_Volt_Scale * LOAD_CurrT_Max_Step_CND;
+		if (Volt_Set > (PV_Volt_DAQ_New + Step_Max)) Volt_Set = PV_Volt_DAQ_New + Step_Max;
+		else if (Volt_Set < (PV_Volt_DAQ_New - Step_Max)) Volt_Set = PV_Volt_DAQ_New - Step_Max;
+		if ((LOAD_Pow_Volt_Limit > 0) && (Volt_Set > LOAD_Pow_Volt_Limit)) Volt_Set = LOAD_Pow_Volt_Limit;
+		if (Volt_Set < 0) Volt_Set = 0;
+		PV_Volt_DAQ_New = Volt_Set;
+	}
+	else {
+		if (AI_Volt > AI_Volt_Scale) LOAD_Curr_PID_Update(PV_Pow_Setpoint / AI_Volt);
+		else LOAD_Curr_PID_Update(PV_Pow_Setpoint / AI_Volt_Scale); // at 0V, go up
+		if (PV_Volt_DAQ_New < LOAD_Pow_Volt_Limit) {
+			PV_Volt_DAQ_New = LOAD_Pow_Volt_Limit;
+			Track_PID_Integral = LOAD_Pow_Volt_Limit;
+		}
+	}
+	
+}
+
+//-------------------------------------------------------------------------------------------
+// Constant Resistance Control Init
+void PV_Mode__Constant_Resistance_Init(){
+	/* function initializes the constant resistance mode, start voltage from a recent IV curve or 0V */
+	float Volt_FF;
+	
+	Track_Status = 0; // reset all of it!
+	PV_Mode_ACT = PV_Mode_CTR;
+	PV_Volt_DAQ_New = 0;
+	if (PV_Res_Setpoint > 0) {
+		Volt_FF = LOAD_Get_Feed_Forward_Volt(0, 1.0 / PV_Res_Setpoint);
+		if (Volt_FF > 0) PV_Volt_DAQ_New = Volt_FF;
+	}
+	Track_PID_Integral = PV_Volt_DAQ_New; // bumpless start of the PID
+	Track_Curr_Old = AI_Curr_Corr;
+	
+}
+
+//-------------------------------------------------------------------------------------------
+// Constant Resistance Control Main
+void PV_Mode__Constant_Resistance_Main(){
+	/* this is the main function controlling the constant resistance output, called once per cycle
+	- the current PID regulates to the current of the resistance set-point at the actual voltage
+	- the load line and the IV curve cross only once, so there is no wrong side to end up on
+	- 0 Ohm or less is a short circuit */
+	if (PV_Res_Setpoint > 0) {
+		LOAD_Curr_PID_Update(AI_Volt / PV_Res_Setpoint);
+	}
+	else {
+		PV_Volt_DAQ_New = 0;
+		Track_PID_Integral = 0;
+	}
+	
+}
@@ -21,6 +21,40 @@
 #define BIAS_VOLT_ERROR_TIMEOUT_MAX 200 // counter max dependent on load control loop time -> 200 @ 0.025s = 5s timeout
 #define BIAS_VOLT_ERROR_DELAY_MAX 20 // counter max dependent on load control loop time -> 200 @ 0.025s = 0.5s timeout
 #define FAN_RELAY_SWITCH_TIME_MS 5
+#define LOAD_SDM_ISC_REGION 0.2 // fraction of max. IV voltage, points below are used for the Isc & shunt fit
+#define LOAD_SDM_VOC_REGION 0.9 // fraction of max. IV voltage, points above are used for the Voc & series resistance fit
+#define LOAD_SDM_EG_K 13009.0 // silicon band gap 1.121eV divided by the Boltzmann constant in [K]
+#define LOAD_SDM_VT_K 8.617e-5 // thermal voltage per Kelvin k/q in [V/K]
+#define LOAD_SDM_T_REF_K 298.15 // temperature assumed if no valid RTD temperature is available
+#define LOAD_SDM_T_MIN_C -40.0 // RTD temperature range regarded as valid for the model
+#define LOAD_SDM_T_MAX_C 120.0
+#define LOAD_SDM_NEWTON_MAX 8 // maximum iterations of the Vmp search per MPPT update
+#define LOAD_SDM_NEWTON_TOL 0.001 // Vmp search resolution as fraction of the modified ideality factor
+#define LOAD_GSS_RATIO 0.618034 // golden section ratio
+#define LOAD_GSS_IV_WIDEN 0.05 // bracket half width as fraction of Vmp if there is no IV point below or above PMAX
+#define LOAD_FVOC_FACT_DEFAULT 0.76 // Vmp/Voc fraction used if auto-calibration has no valid IV curve
+#define LOAD_FVOC_FACT_MIN 0.5 // range of the Vmp/Voc fraction regarded as valid
+#define LOAD_FVOC_FACT_MAX 0.95
+#define LOAD_PROF_MAX_STEPS 6 // number of set-point profile steps in the EEPROM step table
+#define LOAD_PROF_REPEAT_ENDLESS 255 // profile step repeat count that repeats forever
+#define LOAD_ENERGY_MODES 12 // number of load mode IDs with own energy accumulators
+#define LOAD_ENERGY_ALL 255 // energy query selection of the sum of all load modes
+#define LOAD_ENERGY_SCALE 1.0e9 // energy & charge accumulator units per [Ws] & [As], nWs & nAs
+#define LOAD_ENERGY_SCALE_HOUR 3.6e12 // accumulator units per [Wh] & [Ah]
+#define LOAD_ENERGY_PMP_MAX_AGE_S 900.0 // maximum age of the IV curve Pmp used as tracking efficiency reference [s]
+
+// golden section search states
+#define LOAD_GSS__X1_FIRST		0 // first inner point set, measure its power
+#define LOAD_GSS__X2			1 // upper inner point set, measure its power & narrow
+#define LOAD_GSS__X1			2 // lower inner point set, measure its power & narrow
+#define LOAD_GSS__HOLD_REF		3 // bracket converged, measure hold power reference
+#define LOAD_GSS__HOLD			4 // hold & watch power drift
+
+// set-point profile states
+#define LOAD_PROF__STOP			0 // not running or finished
+#define LOAD_PROF__RUN			1 // running, step time elapsing
+#define LOAD_PROF__PAUSE		2 // step time held, load stays in the step mode
+#define LOAD_PROF__ERROR		3 // stopped at a step with an invalid load mode, load stays in the mode before
 
 // PV mode definitions ( 0 is uninitialized)
 #define PV_Mode__NONE			0
@@ -29,6 +63,13 @@
 #define PV_Mode__Const_Volt		3
 #define PV_Mode__Const_Curr		4
 #define PV_Mode__MPPT_Simple	5
+#define PV_Mode__MPPT_IncCond	6
+#define PV_Mode__MPPT_Model		7
+#define PV_Mode__MPPT_Golden	8
+#define PV_Mode__Const_Power	9
+#define PV_Mode__Const_Res		10
+#define PV_Mode__MPPT_FVoc		11
+#define PV_Mode__MAX_ID			11 // highest valid load mode ID
 
 //----------------------------------------
 //	Track_Status:
@@ -36,8 +77,14 @@
 				#define SET__Track_Status_Dir_Volt_Up (SETBIT(Track_Status, 0))
 				#define CLR__Track_Status_Dir_Volt_Up (CLRBIT(Track_Status, 0))
 				#define is_Track_Status_Dir_Volt_Up ((Track_Status & BIT(0)))
-//		Bit1:	none
-//		Bit2:	none
+//		Bit1:	Mini IV sweep around set-point requested
+				#define SET__Track_Status_Mini_IV_Request (SETBIT(Track_Status, 1))
+				#define CLR__Track_Status_Mini_IV_Request (CLRBIT(Track_Status, 1))
+				#define is_Track_Status_Mini_IV_Request ((Track_Status & BIT(1)))
+//		Bit2:	IncCond set-point held at MPP
+				#define SET__Track_Status_IncC_Hold (SETBIT(Track_Status, 2))
+				#define CLR__Track_Status_IncC_Hold (CLRBIT(Track_Status, 2))
+				#define is_Track_Status_IncC_Hold ((Track_Status & BIT(2)))
 //		Bit3:	none
 //		Bit4:	none
 //		Bit5:	none
@@ -91,11 +138,53 @@ extern volatile float LOAD_MPPT_Step_Increase_Fact;
 extern volatile float LOAD_MPPT_Step_Reduction_Fact;
 extern volatile float LOAD_MPPT_Tolerance_CND;
 extern volatile uint16_t LOAD_MPPT_Timer_Update_Delay;
+extern volatile uint16_t LOAD_MPPT_Mini_IV_Interval;
+extern volatile uint16_t LOAD_MPPT_Mini_IV_Counter;
+extern volatile float LOAD_IncC_Cond_Band;
+extern volatile float LOAD_IncC_Volt_Noise_CND;
+extern volatile float LOAD_IncC_Curr_Noise_CND;
+extern volatile bool LOAD_SDM_Valid;
+extern volatile float LOAD_SDM_Iph;
+extern volatile float LOAD_SDM_I0;
+extern volatile float LOAD_SDM_A;
+extern volatile float LOAD_SDM_Rs;
+extern volatile float LOAD_SDM_Gsh;
+extern volatile float LOAD_SDM_T_Fit_K;
+extern volatile float LOAD_SDM_Vmp;
+extern volatile float LOAD_GSS_Low_Voc_Fact;
+extern volatile float LOAD_GSS_High_Voc_Fact;
+extern volatile float LOAD_GSS_Drift_Fact;
+extern volatile float LOAD_FVoc_Fact;
+extern volatile uint16_t LOAD_FVoc_Interval;
+extern volatile uint8_t LOAD_FVoc_Settle_ms;
+extern volatile float LOAD_FVoc_Fact_Act;
+extern volatile float LOAD_FVoc_Voc;
 extern volatile float LOAD_CurrT_Max_Step_CND;
-extern volatile float LOAD_CurrT_Min_Step_CND;
-extern volatile float LOAD_CurrT_Step_Increase_Fact;
-extern volatile float LOAD_CurrT_Step_Reduction_Fact;
 extern volatile float LOAD_CurrT_Tolerance_CND;
+extern volatile float LOAD_CurrT_PID_Kp;
+extern volatile float LOAD_CurrT_PID_Ki;
+extern volatile float LOAD_CurrT_PID_Kd;
+extern volatile uint16_t LOAD_CurrT_FF_Max_Age_s;
+extern volatile float PV_Pow_Setpoint;
+extern volatile uint8_t LOAD_Pow_Isc_Side;
+extern volatile float PV_Res_Setpoint;
+extern volatile uint8_t LOAD_Prof_Count;
+extern volatile uint8_t LOAD_Prof_Mode[LOAD_PROF_MAX_STEPS];
+extern volatile float LOAD_Prof_Setpoint[LOAD_PROF_MAX_STEPS];
+extern volatile uint16_t LOAD_Prof_Duration_s[LOAD_PROF_MAX_STEPS];
+extern volatile uint8_t LOAD_Prof_Repeat[LOAD_PROF_MAX_STEPS];
+extern volatile uint8_t LOAD_Prof_State;
+extern volatile uint8_t LOAD_Prof_Step;
+extern volatile uint8_t LOAD_Prof_Repeat_Left[LOAD_PROF_MAX_STEPS];
+extern volatile int64_t LOAD_Energy_Tot_nWs[LOAD_ENERGY_MODES];
+extern volatile int64_t LOAD_Charge_Tot_nAs[LOAD_ENERGY_MODES];
+extern volatile int64_t LOAD_Energy_Ref_Tot_nWs[LOAD_ENERGY_MODES];
+extern volatile int64_t LOAD_Energy_Pmp_Tot_nWs[LOAD_ENERGY_MODES];
+extern volatile int64_t LOAD_Energy_Rst_nWs[LOAD_ENERGY_MODES];
+extern volatile int64_t LOAD_Charge_Rst_nAs[LOAD_ENERGY_MODES];
+extern volatile int64_t LOAD_Energy_Ref_Rst_nWs[LOAD_ENERGY_MODES];
+extern volatile int64_t LOAD_Energy_Pmp_Rst_nWs[LOAD_ENERGY_MODES];
+extern volatile uint8_t LOAD_Energy_Select;
 
 // Fan control variables
 extern volatile uint8_t FAN_CTR_State;
@@ -143,11 +232,31 @@ extern EEMEM float EROM_LOAD_MPPT_Step_Increase_Fact;
 extern EEMEM float EROM_LOAD_MPPT_Step_Reduction_Fact;
 extern EEMEM float EROM_LOAD_MPPT_Tolerance_CND;
 extern EEMEM uint16_t EROM_LOAD_MPPT_Timer_Update_Delay;
+extern EEMEM uint16_t EROM_LOAD_MPPT_Mini_IV_Interval;
+extern EEMEM float EROM_LOAD_IncC_Cond_Band;
+extern EEMEM float EROM_LOAD_IncC_Volt_Noise_CND;
+extern EEMEM float EROM_LOAD_IncC_Curr_Noise_CND;
+extern EEMEM float EROM_LOAD_GSS_Low_Voc_Fact;
+extern EEMEM float EROM_LOAD_GSS_High_Voc_Fact;
+extern EEMEM float EROM_LOAD_GSS_Drift_Fact;
+extern EEMEM float EROM_LOAD_FVoc_Fact;
+extern EEMEM uint16_t EROM_LOAD_FVoc_Interval;
+extern EEMEM uint8_t EROM_LOAD_FVoc_Settle_ms;
 extern EEMEM float EROM_LOAD_CurrT_Max_Step_CND;
-extern EEMEM float EROM_LOAD_CurrT_Min_Step_CND;
-extern EEMEM float EROM_LOAD_CurrT_Step_Increase_Fact;
-extern EEMEM float EROM_LOAD_CurrT_Step_Reduction_Fact;
+extern EEMEM float EROM_LOAD_CurrT_Reserved[3];
 extern EEMEM float EROM_LOAD_CurrT_Tolerance_CND;
+extern EEMEM float EROM_LOAD_CurrT_PID_Kp;
+extern EEMEM float EROM_LOAD_CurrT_PID_Ki;
+extern EEMEM float EROM_LOAD_CurrT_PID_Kd;
+extern EEMEM uint16_t EROM_LOAD_CurrT_FF_Max_Age_s;
+extern EEMEM float EROM_PV_Pow_Setpoint;
+extern EEMEM uint8_t EROM_LOAD_Pow_Isc_Side;
+extern EEMEM float EROM_PV_Res_Setpoint;
+extern EEMEM uint8_t EROM_LOAD_Prof_Count;
+extern EEMEM uint8_t EROM_LOAD_Prof_Mode[LOAD_PROF_MAX_STEPS];
+extern EEMEM float EROM_LOAD_Prof_Setpoint[LOAD_PROF_MAX_STEPS];
+extern EEMEM uint16_t EROM_LOAD_Prof_Duration_s[LOAD_PROF_MAX_STEPS];
+extern EEMEM uint8_t EROM_LOAD_Prof_Repeat[LOAD_PROF_MAX_STEPS];
 extern EEMEM uint8_t EROM_PV_Mode_CTR;
 extern EEMEM float EROM_PV_Volt_Setpoint;
 extern EEMEM float EROM_PV_Curr_Setpoint;
@@ -173,8 +282,42 @@ bool Check_if_Active_Errors_Output_Disabled();
 bool Check_Temp_Disconnect_State();
 void PV_Mode__Constant_Current_Main();
 void PV_Mode__Constant_Current_Init();
+void LOAD_Curr_PID_Update(float Curr_Setpoint);
+float LOAD_Get_Feed_Forward_Volt(float Curr, float Cond);
+void PV_Mode__Constant_Power_Main();
+void PV_Mode__Constant_Power_Init();
+void PV_Mode__Constant_Resistance_Main();
+void PV_Mode__Constant_Resistance_Init();
 void PV_Mode__MPPT_Simple_Main();
 void PV_Mode__MPPT_Simple_Init();
+void PV_Mode__MPPT_IncCond_Main();
+void PV_Mode__MPPT_IncCond_Init();
+void PV_Mode__MPPT_Model_Main();
+void PV_Mode__MPPT_Model_Init();
+bool LOAD_SDM_Fit_From_IV();
+bool LOAD_SDM_Line_Fit(float Volt_Low, float Volt_High, float *C0, float *C1);
+float LOAD_SDM_Get_Temp_K();
+float LOAD_SDM_Get_Vmp(float Volt, float Curr);
+void PV_Mode__MPPT_Golden_Main();
+void PV_Mode__MPPT_Golden_Init();
+void LOAD_GSS_Start(float Volt_Low, float Volt_High);
+void LOAD_GSS_Start_From_IV();
+void LOAD_GSS_Narrow();
+void PV_Mode__MPPT_FVoc_Main();
+void PV_Mode__MPPT_FVoc_Init();
+void LOAD_FVoc_Calibrate_From_IV();
+void LOAD_FVoc_Sample();
+bool LOAD_Profile_Start();
+void LOAD_Profile_Stop();
+void LOAD_Profile_Pause();
+void LOAD_Profile_Resume();
+void LOAD_Profile_Process();
+void LOAD_Profile_Next_Step(bool Keep_Cadence);
+void LOAD_Profile_Apply_Step();
+float LOAD_Profile_Get_Elapsed_s();
+void LOAD_Energy_Process();
+void LOAD_Energy_Reset();
+int64_t LOAD_Energy_Sum(volatile int64_t *Acc);
 
 //end
 #endif /* MPPT_PCB_MCU__LOAD_CTR_H_ */
\ No newline at end of file
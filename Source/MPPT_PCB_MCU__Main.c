@@ -40,6 +40,7 @@ volatile uint8_t Timer_Control_Counter;
 volatile uint16_t Timer_Temp_Meas_Counter;
 volatile uint8_t Timer_Control_Match;
 volatile uint8_t Timer_Temp_Meas_Match;
+volatile uint32_t Timer_Main_Ticks;		// free running main timer tick counter, used as time base
 
 //Convert 16to8 bit integer
 typedef union {
@@ -76,6 +77,7 @@ int main(void)
 	//OSCCAL=0x97; // calibrate internal oscillator (when running on internal 8MHz clock source)
 	TimerMeas_Count 	= 0;
 	Timer_Control_Counter	= 0;
+	Timer_Main_Ticks = 0;
 	SysStatus_A 	= 0;
 	SysControl	= 0;
 	SysConfig	= 0;
@@ -149,6 +151,9 @@ int main(void)
 	// initialize / reset fan control
 	Reset_Fan_Control();
 	
+	// set first scheduled IV measurement (needs com address & timer settings)
+	IV_Schedule_Reset();
+	
 	// set PI controller defaults
 	PI_CRT__Process_Controller_Settings();
 	
@@ -323,6 +328,40 @@ void RS485_get_com_address_external_pins(){
 		
 }
 
+//-------------------------------------------------------------------------------------------
+// Get main timer ticks
+uint32_t Get_Timer_Main_Ticks(){
+	/* returns the free running main timer tick counter
+	- 32bit value is updated in the timer interrupt, so interrupts are held off while reading
+	*/
+	uint8_t TempSREG;
+	uint32_t Ticks;
+	TempSREG = SREG;
+	cli();
+	Ticks = Timer_Main_Ticks;
+	SREG = TempSREG;
+	return Ticks;
+}
+
+//-------------------------------------------------------------------------------------------
+// Get main timer counts
+uint32_t Get_Timer_1_Counts(){
+	/* returns the free running main timer in timer 1 counts, for time stamps finer than the main timer tick
+	- combines the tick counter with the timer 1 counter value
+	- if the compare match interrupt is pending, the counter has already restarted and the tick is not counted yet
+	*/
+	uint8_t TempSREG;
+	uint32_t Ticks;
+	uint16_t Counts;
+	TempSREG = SREG;
+	cli();
+	Ticks = Timer_Main_Ticks;
+	Counts = TCNT1;
+	if ((TIFR1 & (1<<OCF1A)) && (Counts < (OCR1A >> 1))) Ticks++;
+	SREG = TempSREG;
+	return Ticks * ((uint32_t) OCR1A + 1) + Counts;
+}
+
 
 //===========================================================================================
 // INTERUPT Function
@@ -431,6 +470,7 @@ ISR (TIMER1_COMPA_vect){
 	// set measurement & com start flag
 	if(is_Timer_CTR_Main_Flag_On) SET__Status_MainTimerOverRun;
 	SET__Timer_CTR_Main_Flag;
+	Timer_Main_Ticks++;
 	
 	//Increase Meas control counter - check CAL counter
 	Timer_Control_Counter++;
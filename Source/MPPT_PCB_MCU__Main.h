@@ -61,6 +61,8 @@
 	#define CONTROL_TIMER_MULT 5		// 5 (6) = every 25.0ms; 20ms/50Hz 4xAVR AI update over a single line cycle, ~ 5ms for settling
 	#define TEMP_MEAS_TIMER_MUILT 100	// 80 = ~500ms @ 5ms;
 #endif /* Line_Freq_50 */
+#define TIMER_1_TICK_TIME_S (((float) OCR1A + 1.0) * 64.0 / (float) F_CPU)	// main timer tick time in seconds, 64 clock divider
+#define TIMER_1_COUNT_TIME_S (64.0 / (float) F_CPU)	// main timer counter resolution in seconds
 
 #define DeviceName "OPET_R1.4B"
 #define FirmwareVersion "V1.16A-D08M03Y24"
@@ -370,7 +372,10 @@
 //		Bit7:	none
 //----------------------------------------
 //	UartStatus:
-//		Bit0:	none
+//		Bit0:	IV Data Stream indicator, IV points are send while measuring
+				#define SET__COM_Status_IV_Stream (SETBIT(UartStatus, 0))
+				#define CLR__COM_Status_IV_Stream (CLRBIT(UartStatus, 0))
+				#define is_COM_Status_IV_Stream_On ((UartStatus & BIT(0)))
 //		Bit1:	none
 //		Bit2:	none
 //		Bit3:	none
@@ -410,6 +415,7 @@ extern volatile uint8_t Temp_Sensor_Type;
 extern volatile uint8_t EEMEM_Written;
 extern volatile uint8_t Timer_Control_Match;
 extern volatile uint8_t Timer_Temp_Meas_Match;
+extern volatile uint32_t Timer_Main_Ticks;
 
 //===========================================================================================
 // EXTERN EEPROM VARIABLES
@@ -424,6 +430,8 @@ extern EEMEM uint8_t EROM_Temp_Sensor_Type;
 // FUNCTION Prototypes
 void Set_DDR_and_Default_State();
 void RS485_get_com_address_external_pins();
+uint32_t Get_Timer_Main_Ticks();
+uint32_t Get_Timer_1_Counts();
 
 //end
 #endif /* MPPT_PCB_MCU__Main_H_ */
\ No newline at end of file
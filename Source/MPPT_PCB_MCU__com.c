@@ -148,6 +148,7 @@ void UART_Execute_Command(char *Address, char *Value){
 	
 	char READ_IND_CHAR = UART_COM_READ_INDICATOR; // write to variable to use less memory
 	uint8_t Last_OutSTR_L;
+	uint8_t i;
 	// uint8_t Tmp_UI8;
 	float Tmp_FLOAT;
 	int32_t Tmp_I32;
@@ -262,6 +263,40 @@ void UART_Execute_Command(char *Address, char *Value){
 	COM_Copy_To_OutSTR_From_Start("LOAD:");
 	Last_OutSTR_L = OutSTR_L;
 	if (COM_Compare_to_OutStr(Address)) {
+		//------------------------------
+		// R - LOAD:MODEL - single diode model of the model based MPPT
+		COM_Add_To_OutSTR_At_Position("MODEL", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == READ_IND_CHAR) {
+				COM_Add_QuestMark_To_OutSTR_No_Sep();
+				if (!LOAD_SDM_Valid) {
+					// no model fitted, no parameters
+					COM_Add_To_OutSTR_with_Sep("0");
+					UART_WriteString (&OutSTR[0]);
+					goto UART_Execute_Command_END;
+				}
+				COM_Add_To_OutSTR_with_Sep("1");
+				FloatToString(Value, LOAD_SDM_Iph);
+				COM_Add_To_OutSTR_with_Sep(Value);
+				FloatToString(Value, LOAD_SDM_I0);
+				COM_Add_To_OutSTR_with_Sep(Value);
+				FloatToString(Value, LOAD_SDM_A / (LOAD_SDM_VT_K * LOAD_SDM_T_Fit_K)); // ideality factor times cells in series
+				COM_Add_To_OutSTR_with_Sep(Value);
+				FloatToString(Value, LOAD_SDM_Rs);
+				COM_Add_To_OutSTR_with_Sep(Value);
+				if (LOAD_SDM_Gsh > 0) Tmp_FLOAT = 1.0 / LOAD_SDM_Gsh;
+				else Tmp_FLOAT = 0; // no shunt measured
+				FloatToString(Value, Tmp_FLOAT);
+				COM_Add_To_OutSTR_with_Sep(Value);
+				FloatToString(Value, LOAD_SDM_T_Fit_K - 273.15);
+				COM_Add_To_OutSTR_with_Sep(Value);
+				FloatToString(Value, LOAD_SDM_Vmp);
+				COM_Add_To_OutSTR_with_Sep(Value);
+				UART_WriteString (&OutSTR[0]);
+			}
+			else goto UART_Execute_Command_ERROR;
+			goto UART_Execute_Command_END;
+		}
 		//------------------------------
 		// R/W - LOAD:MODE - PV load mode control
 		COM_Add_To_OutSTR_At_Position("MODE", Last_OutSTR_L);
@@ -314,6 +349,190 @@ void UART_Execute_Command(char *Address, char *Value){
 			goto UART_Execute_Command_END;
 		}
 		//------------------------------
+		// R/W - LOAD:SETPOW - Power Set point for power load mode
+		COM_Add_To_OutSTR_At_Position("SETPOW", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == '\0') {
+				// Write data, if number is invalid will return 0, meaning Voc or Isc depending on side
+				PV_Pow_Setpoint = StringToFloat(Value);	//Read string to float
+				if (PV_Pow_Setpoint < 0) PV_Pow_Setpoint = 0;
+			}
+			else if (Address[OutSTR_L] == READ_IND_CHAR) COM_Add_QuestMark_To_OutSTR_No_Sep();
+			else goto UART_Execute_Command_ERROR;
+			// Return data read-back
+			FloatToString(Value, PV_Pow_Setpoint);	//Write float back to string
+			COM_Add_To_OutSTR_with_Sep(Value);
+			UART_WriteString (&OutSTR[0]);
+			goto UART_Execute_Command_END;
+		}
+		//------------------------------
+		// R/W - LOAD:SETRES - Resistance Set point for resistance load mode
+		COM_Add_To_OutSTR_At_Position("SETRES", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == '\0') {
+				// Write data, if number is invalid will return 0, meaning short circuit
+				PV_Res_Setpoint = StringToFloat(Value);	//Read string to float
+				if (PV_Res_Setpoint < 0) PV_Res_Setpoint = 0;
+			}
+			else if (Address[OutSTR_L] == READ_IND_CHAR) COM_Add_QuestMark_To_OutSTR_No_Sep();
+			else goto UART_Execute_Command_ERROR;
+			// Return data read-back
+			FloatToString(Value, PV_Res_Setpoint);	//Write float back to string
+			COM_Add_To_OutSTR_with_Sep(Value);
+			UART_WriteString (&OutSTR[0]);
+			goto UART_Execute_Command_END;
+		}
+		//------------------------------
+		// R - LOAD:FVOC - active factor & last Voc sample of the fractional Voc MPPT
+		COM_Add_To_OutSTR_At_Position("FVOC", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == READ_IND_CHAR) {
+				COM_Add_QuestMark_To_OutSTR_No_Sep();
+				FloatToString(Value, LOAD_FVoc_Fact_Act);
+				COM_Add_To_OutSTR_with_Sep(Value);
+				FloatToString(Value, LOAD_FVoc_Voc);
+				COM_Add_To_OutSTR_with_Sep(Value);
+				UART_WriteString (&OutSTR[0]);
+			}
+			else goto UART_Execute_Command_ERROR;
+			goto UART_Execute_Command_END;
+		}
+		//------------------------------
+		// R/W - LOAD:PROF:RUN - start (1) or stop (0) the set-point profile
+		COM_Add_To_OutSTR_At_Position("PROF:RUN", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == '\0') {
+				// Write data, start from first step, anything else than 1 stops
+				if (atol(Value) == 1) LOAD_Profile_Start();
+				else LOAD_Profile_Stop();
+			}
+			else if (Address[OutSTR_L] == READ_IND_CHAR) COM_Add_QuestMark_To_OutSTR_No_Sep();
+			else goto UART_Execute_Command_ERROR;
+			// Return data read-back, profile state
+			itoa (LOAD_Prof_State, Value, 10);
+			COM_Add_To_OutSTR_with_Sep(Value);
+			UART_WriteString (&OutSTR[0]);
+			goto UART_Execute_Command_END;
+		}
+		//------------------------------
+		// R/W - LOAD:PROF:PAUSE - pause (1) or resume (0) the set-point profile
+		COM_Add_To_OutSTR_At_Position("PROF:PAUSE", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == '\0') {
+				// Write data
+				if (atol(Value) == 1) LOAD_Profile_Pause();
+				else LOAD_Profile_Resume();
+			}
+			else if (Address[OutSTR_L] == READ_IND_CHAR) COM_Add_QuestMark_To_OutSTR_No_Sep();
+			else goto UART_Execute_Command_ERROR;
+			// Return data read-back, profile state
+			itoa (LOAD_Prof_State, Value, 10);
+			COM_Add_To_OutSTR_with_Sep(Value);
+			UART_WriteString (&OutSTR[0]);
+			goto UART_Execute_Command_END;
+		}
+		//------------------------------
+		// W - LOAD:PROF:SKIP - end the active set-point profile step now
+		COM_Add_To_OutSTR_At_Position("PROF:SKIP", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == '\0') {
+				// Write data - no Value to read here, only accepted while the profile is running or paused
+				if ((LOAD_Prof_State == LOAD_PROF__RUN) || (LOAD_Prof_State == LOAD_PROF__PAUSE)) {
+					LOAD_Profile_Next_Step(false);
+					COM_Add_To_OutSTR_with_Sep("1");
+				}
+				else COM_Add_To_OutSTR_with_Sep("0");
+			}
+			else goto UART_Execute_Command_ERROR;
+			// Return handshake
+			UART_WriteString (&OutSTR[0]);
+			goto UART_Execute_Command_END;
+		}
+		//------------------------------
+		// R - LOAD:PROF:STEP - state, active step, elapsed step time & repeats left of the set-point profile
+		COM_Add_To_OutSTR_At_Position("PROF:STEP", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == READ_IND_CHAR) {
+				COM_Add_QuestMark_To_OutSTR_No_Sep();
+				itoa (LOAD_Prof_State, Value, 10);
+				COM_Add_To_OutSTR_with_Sep(Value);
+				itoa (LOAD_Prof_Step, Value, 10);
+				COM_Add_To_OutSTR_with_Sep(Value);
+				FloatToString(Value, LOAD_Profile_Get_Elapsed_s());
+				COM_Add_To_OutSTR_with_Sep(Value);
+				itoa (LOAD_Prof_Repeat_Left[LOAD_Prof_Step], Value, 10);
+				COM_Add_To_OutSTR_with_Sep(Value);
+				UART_WriteString (&OutSTR[0]);
+			}
+			else goto UART_Execute_Command_ERROR;
+			goto UART_Execute_Command_END;
+		}
+		//------------------------------
+		// R/W - LOAD:ENERGY:MODE - load mode reported by LOAD:ENERGY?, 255 = sum of all modes
+		COM_Add_To_OutSTR_At_Position("ENERGY:MODE", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == '\0') {
+				// Write data, invalid load modes select the sum of all modes
+				Tmp_I32 = atol(Value);	//Read string to long integer
+				if ((Tmp_I32 >= 0) && (Tmp_I32 < LOAD_ENERGY_MODES)) LOAD_Energy_Select = (uint8_t) Tmp_I32;
+				else LOAD_Energy_Select = LOAD_ENERGY_ALL;
+			}
+			else if (Address[OutSTR_L] == READ_IND_CHAR) COM_Add_QuestMark_To_OutSTR_No_Sep();
+			else goto UART_Execute_Command_ERROR;
+			// Return data read-back
+			itoa (LOAD_Energy_Select, Value, 10);
+			COM_Add_To_OutSTR_with_Sep(Value);
+			UART_WriteString (&OutSTR[0]);
+			goto UART_Execute_Command_END;
+		}
+		//------------------------------
+		// W - LOAD:ENERGY:RST - clear the since reset energy accumulators of all load modes
+		COM_Add_To_OutSTR_At_Position("ENERGY:RST", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == '\0') {
+				// Write data - no Value to read here
+				LOAD_Energy_Reset();
+				COM_Add_To_OutSTR_with_Sep("1");
+			}
+			else goto UART_Execute_Command_ERROR;
+			// Return handshake
+			UART_WriteString (&OutSTR[0]);
+			goto UART_Execute_Command_END;
+		}
+		//------------------------------
+		// R - LOAD:ENERGY - energy, charge & tracking efficiency since reset & since start-up
+		COM_Add_To_OutSTR_At_Position("ENERGY", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == READ_IND_CHAR) {
+				COM_Add_QuestMark_To_OutSTR_No_Sep();
+				itoa (LOAD_Energy_Select, Value, 10);
+				COM_Add_To_OutSTR_with_Sep(Value);
+				// since reset
+				FloatToString(Value, (float) LOAD_Energy_Sum(LOAD_Energy_Rst_nWs) / LOAD_ENERGY_SCALE_HOUR);
+				COM_Add_To_OutSTR_with_Sep(Value);
+				FloatToString(Value, (float) LOAD_Energy_Sum(LOAD_Charge_Rst_nAs) / LOAD_ENERGY_SCALE_HOUR);
+				COM_Add_To_OutSTR_with_Sep(Value);
+				Tmp_FLOAT = (float) LOAD_Energy_Sum(LOAD_Energy_Pmp_Rst_nWs);
+				if (Tmp_FLOAT > 0) Tmp_FLOAT = (float) LOAD_Energy_Sum(LOAD_Energy_Ref_Rst_nWs) / Tmp_FLOAT;
+				else Tmp_FLOAT = 0; // no IV curve Pmp reference
+				FloatToString(Value, Tmp_FLOAT);
+				COM_Add_To_OutSTR_with_Sep(Value);
+				// since start-up
+				FloatToString(Value, (float) LOAD_Energy_Sum(LOAD_Energy_Tot_nWs) / LOAD_ENERGY_SCALE_HOUR);
+				COM_Add_To_OutSTR_with_Sep(Value);
+				FloatToString(Value, (float) LOAD_Energy_Sum(LOAD_Charge_Tot_nAs) / LOAD_ENERGY_SCALE_HOUR);
+				COM_Add_To_OutSTR_with_Sep(Value);
+				Tmp_FLOAT = (float) LOAD_Energy_Sum(LOAD_Energy_Pmp_Tot_nWs);
+				if (Tmp_FLOAT > 0) Tmp_FLOAT = (float) LOAD_Energy_Sum(LOAD_Energy_Ref_Tot_nWs) / Tmp_FLOAT;
+				else Tmp_FLOAT = 0; // no IV curve Pmp reference
+				FloatToString(Value, Tmp_FLOAT);
+				COM_Add_To_OutSTR_with_Sep(Value);
+				UART_WriteString (&OutSTR[0]);
+			}
+			else goto UART_Execute_Command_ERROR;
+			goto UART_Execute_Command_END;
+		}
+		//------------------------------
 		// R/W - LOAD:MPPT:DELAY - MPPT update delay in cycles 
 		COM_Add_To_OutSTR_At_Position("MPPT:DELAY", Last_OutSTR_L);
 		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
@@ -333,6 +552,83 @@ void UART_Execute_Command(char *Address, char *Value){
 			UART_WriteString (&OutSTR[0]);
 			goto UART_Execute_Command_END;
 		}
+		//------------------------------
+		// R/W - LOAD:MPPT:MINI:INT - MPPT mini IV sweep interval in cycles (0 = off)
+		COM_Add_To_OutSTR_At_Position("MPPT:MINI:INT", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == '\0') {
+				// Write data
+				Tmp_I32 = atol(Value);	//Read string to long integer
+				// limit boundaries
+				if (Tmp_I32 > 60000) LOAD_MPPT_Mini_IV_Interval = 60000;
+				else if (Tmp_I32 <= 0) LOAD_MPPT_Mini_IV_Interval = 0;
+				else LOAD_MPPT_Mini_IV_Interval = (uint16_t) Tmp_I32;
+				LOAD_MPPT_Mini_IV_Counter = LOAD_MPPT_Mini_IV_Interval;
+			}
+			else if (Address[OutSTR_L] == READ_IND_CHAR) COM_Add_QuestMark_To_OutSTR_No_Sep();
+			else goto UART_Execute_Command_ERROR;
+			// Return data read-back
+			ltoa (LOAD_MPPT_Mini_IV_Interval, Value, 10);
+			COM_Add_To_OutSTR_with_Sep(Value);
+			UART_WriteString (&OutSTR[0]);
+			goto UART_Execute_Command_END;
+		}
+		//------------------------------
+		// R/W - LOAD:MPPT:MINI:PTS - number of MPPT mini IV sweep points
+		COM_Add_To_OutSTR_At_Position("MPPT:MINI:PTS", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == '\0') {
+				// Write data
+				Tmp_I32 = atol(Value);	//Read string to long integer
+				// limit boundaries
+				if (Tmp_I32 > IV_MINI_MAX_POINTS) IV_Mini_Points = IV_MINI_MAX_POINTS;
+				else if (Tmp_I32 <= MIN_IV_POINTS) IV_Mini_Points = MIN_IV_POINTS;
+				else IV_Mini_Points = (uint8_t) Tmp_I32;
+			}
+			else if (Address[OutSTR_L] == READ_IND_CHAR) COM_Add_QuestMark_To_OutSTR_No_Sep();
+			else goto UART_Execute_Command_ERROR;
+			// Return data read-back
+			itoa (IV_Mini_Points, Value, 10);
+			COM_Add_To_OutSTR_with_Sep(Value);
+			UART_WriteString (&OutSTR[0]);
+			goto UART_Execute_Command_END;
+		}
+		//------------------------------
+		// R/W - LOAD:MPPT:MINI:WIN - MPPT mini IV sweep window, fraction of set-point voltage
+		COM_Add_To_OutSTR_At_Position("MPPT:MINI:WIN", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == '\0') {
+				// Write data
+				IV_Mini_Window_Fact = StringToFloat(Value);	//Read string to float
+				// limit boundaries
+				if (IV_Mini_Window_Fact > 0.5) IV_Mini_Window_Fact = 0.5;
+				else if (IV_Mini_Window_Fact < 0) IV_Mini_Window_Fact = 0;
+			}
+			else if (Address[OutSTR_L] == READ_IND_CHAR) COM_Add_QuestMark_To_OutSTR_No_Sep();
+			else goto UART_Execute_Command_ERROR;
+			// Return data read-back
+			FloatToString(Value, IV_Mini_Window_Fact);	//Write float back to string
+			COM_Add_To_OutSTR_with_Sep(Value);
+			UART_WriteString (&OutSTR[0]);
+			goto UART_Execute_Command_END;
+		}
+		//------------------------------
+		// W - LOAD:MPPT:MINI - request MPPT mini IV sweep around set-point
+		COM_Add_To_OutSTR_At_Position("MPPT:MINI", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == '\0') {
+				// Write data - no Value to read here, only accepted in active MPPT mode
+				if (PV_Mode_ACT == PV_Mode__MPPT_Simple || PV_Mode_ACT == PV_Mode__MPPT_IncCond) {
+					SET__Track_Status_Mini_IV_Request;
+					COM_Add_To_OutSTR_with_Sep("1");
+				}
+				else COM_Add_To_OutSTR_with_Sep("0");
+			}
+			else goto UART_Execute_Command_ERROR;
+			// Return handshake
+			UART_WriteString (&OutSTR[0]);
+			goto UART_Execute_Command_END;
+		}
 	}
 	// END: Load Control Commands
 	//##############################
@@ -355,12 +651,35 @@ void UART_Execute_Command(char *Address, char *Value){
 				}
 				else {
 					SET__SysControl_IV_Meas;
-					//TODO fix IV measurement time prediction calculation
 					if (IV_Point_Set_Delay_ms >= IV_Setup_Max_Delay_For_Mul) IV_Setup_Signal_Set_Time = 60000;
 					else IV_Setup_Signal_Set_Time = IV_Point_Set_Delay_ms * IV_Setup_Signal_Set_Multiplier + IV_Range_Set_Settle_Time_ms;
-					Tmp_FLOAT =	(float) IV_Meas_Points * (float) IV_Point_Set_Delay_ms + (float) IV_Meas_Points * (float) IV_Point_Meas_Nu_AVR_Sets * 
-								(0.22 + (float) IV_Point_Meas_Nu_AVR_VoltCurr * 0.022) + 200.0 + (4.0 * (float) IV_Setup_Signal_Set_Time) ; // rough calculation of IV measurement time in [ms]
-					Tmp_I32 = Tmp_FLOAT;
+					Tmp_I32 = IV_MEAS__Predict_Time_ms(); // expected IV measurement time in [ms]
+					ltoa (Tmp_I32, Value, 10);
+					COM_Add_To_OutSTR_with_Sep(Value);
+				}
+			}
+			else goto UART_Execute_Command_ERROR;
+			// Return handshake
+			UART_WriteString (&OutSTR[0]);
+			goto UART_Execute_Command_END;
+		}
+		//------------------------------
+		// W - IV:STREAM - Start IV Measurement & send IV points while measuring, host grants bus until termination
+		COM_Add_To_OutSTR_At_Position("STREAM", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == '\0') {
+				// Write data - no Value to read here
+				if (Check_Temp_Disconnect_State() || is_Status_Bias_Error || !is_Output_On) {
+					CLR__SysControl_IV_Meas;
+					COM_Add_To_OutSTR_with_Sep("0");
+				}
+				else {
+					SET__SysControl_IV_Meas;
+					SET__COM_Status_IV_Stream; // no termination, points follow in the same line
+					Trans_IV_Point = 0;
+					if (IV_Point_Set_Delay_ms >= IV_Setup_Max_Delay_For_Mul) IV_Setup_Signal_Set_Time = 60000;
+					else IV_Setup_Signal_Set_Time = IV_Point_Set_Delay_ms * IV_Setup_Signal_Set_Multiplier + IV_Range_Set_Settle_Time_ms;
+					Tmp_I32 = IV_MEAS__Predict_Time_ms(); // expected IV measurement time in [ms]
 					ltoa (Tmp_I32, Value, 10);
 					COM_Add_To_OutSTR_with_Sep(Value);
 				}
@@ -519,6 +838,270 @@ void UART_Execute_Command(char *Address, char *Value){
 			UART_WriteString (&OutSTR[0]);
 			goto UART_Execute_Command_END;
 		}
+		//------------------------------
+		// R/W - IV:RAMP - slew rate of continuous ramp IV measurement in V/s, 0 is off
+		COM_Add_To_OutSTR_At_Position("RAMP", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == '\0') {
+				// Write data
+				Tmp_FLOAT = StringToFloat(Value);	//Read string to float
+				if (Tmp_FLOAT < 0) IV_Ramp_Rate = 0;
+				else IV_Ramp_Rate = Tmp_FLOAT;
+			}
+			else if (Address[OutSTR_L] == READ_IND_CHAR) COM_Add_QuestMark_To_OutSTR_No_Sep();
+			else goto UART_Execute_Command_ERROR;
+			// Return data read-back
+			FloatToString(Value, IV_Ramp_Rate);	//Write float back to string
+			COM_Add_To_OutSTR_with_Sep(Value);
+			UART_WriteString (&OutSTR[0]);
+			goto UART_Execute_Command_END;
+		}
+		//------------------------------
+		// R/W - IV:SEQ:MAX - maximum number of sets of sequential point averaging
+		COM_Add_To_OutSTR_At_Position("SEQ:MAX", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == '\0') {
+				// Write data
+				Tmp_I32 = atol(Value);
+				if (Tmp_I32 < IV_SEQ_MIN_SETS) Tmp_I32 = IV_SEQ_MIN_SETS;
+				else if (Tmp_I32 > 255) Tmp_I32 = 255;
+				IV_Seq_Max_Sets = (uint8_t) Tmp_I32;
+			}
+			else if (Address[OutSTR_L] == READ_IND_CHAR) COM_Add_QuestMark_To_OutSTR_No_Sep();
+			else goto UART_Execute_Command_ERROR;
+			// Return data read-back
+			itoa (IV_Seq_Max_Sets, Value, 10);
+			COM_Add_To_OutSTR_with_Sep(Value);
+			UART_WriteString (&OutSTR[0]);
+			goto UART_Execute_Command_END;
+		}
+		//------------------------------
+		// R/W - IV:SEQ - standard error target of sequential point averaging in ADC counts, 0 is off
+		COM_Add_To_OutSTR_At_Position("SEQ", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == '\0') {
+				// Write data
+				Tmp_FLOAT = StringToFloat(Value);	//Read string to float
+				if (Tmp_FLOAT < 0) IV_Seq_SE_Target = 0;
+				else IV_Seq_SE_Target = Tmp_FLOAT;
+			}
+			else if (Address[OutSTR_L] == READ_IND_CHAR) COM_Add_QuestMark_To_OutSTR_No_Sep();
+			else goto UART_Execute_Command_ERROR;
+			// Return data read-back
+			FloatToString(Value, IV_Seq_SE_Target);	//Write float back to string
+			COM_Add_To_OutSTR_with_Sep(Value);
+			UART_WriteString (&OutSTR[0]);
+			goto UART_Execute_Command_END;
+		}
+		//------------------------------
+		// R/W - IV:DWELL:MULT - learned dwell time as multiple of settling time constant
+		COM_Add_To_OutSTR_At_Position("DWELL:MULT", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == '\0') {
+				// Write data
+				Tmp_FLOAT = StringToFloat(Value);	//Read string to float
+				if (Tmp_FLOAT < 1.0) IV_Dwell_Tau_Mult = 1.0;
+				else IV_Dwell_Tau_Mult = Tmp_FLOAT;
+			}
+			else if (Address[OutSTR_L] == READ_IND_CHAR) COM_Add_QuestMark_To_OutSTR_No_Sep();
+			else goto UART_Execute_Command_ERROR;
+			// Return data read-back
+			FloatToString(Value, IV_Dwell_Tau_Mult);	//Write float back to string
+			COM_Add_To_OutSTR_with_Sep(Value);
+			UART_WriteString (&OutSTR[0]);
+			goto UART_Execute_Command_END;
+		}
+		//------------------------------
+		// R - IV:DWELL:MAP - learned dwell time of each voltage region in ms
+		COM_Add_To_OutSTR_At_Position("DWELL:MAP", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == READ_IND_CHAR) {
+				COM_Add_QuestMark_To_OutSTR_No_Sep();
+				for (i=0; i < IV_DWELL_REGIONS; i++) {
+					ltoa (IV_MEAS__Get_Dwell_ms(i), Value, 10);
+					COM_Add_To_OutSTR_with_Sep(Value);
+				}
+				UART_WriteString (&OutSTR[0]);
+			}
+			else goto UART_Execute_Command_ERROR;
+			goto UART_Execute_Command_END;
+		}
+		//------------------------------
+		// R/W - IV:DWELL - learn dwell times per voltage region, 0 is off, write clears learned dwell times
+		COM_Add_To_OutSTR_At_Position("DWELL", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == '\0') {
+				// Write data
+				Tmp_I32 = atol(Value);
+				if (Tmp_I32 > 0) IV_Dwell_Learn = 1;
+				else IV_Dwell_Learn = 0;
+				IV_MEAS__Dwell_Map_Reset();
+			}
+			else if (Address[OutSTR_L] == READ_IND_CHAR) COM_Add_QuestMark_To_OutSTR_No_Sep();
+			else goto UART_Execute_Command_ERROR;
+			// Return data read-back
+			itoa (IV_Dwell_Learn, Value, 10);
+			COM_Add_To_OutSTR_with_Sep(Value);
+			UART_WriteString (&OutSTR[0]);
+			goto UART_Execute_Command_END;
+		}
+		//------------------------------
+		// R/W - IV:PREEMPH:TAU - time constant of DAC pre-emphasis in us, learned with transient measurements
+		COM_Add_To_OutSTR_At_Position("PREEMPH:TAU", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == '\0') {
+				// Write data
+				Tmp_FLOAT = StringToFloat(Value);	//Read string to float
+				if (Tmp_FLOAT < 0) IV_Preemph_Tau_us = 0;
+				else IV_Preemph_Tau_us = Tmp_FLOAT;
+			}
+			else if (Address[OutSTR_L] == READ_IND_CHAR) COM_Add_QuestMark_To_OutSTR_No_Sep();
+			else goto UART_Execute_Command_ERROR;
+			// Return data read-back
+			FloatToString(Value, IV_Preemph_Tau_us);	//Write float back to string
+			COM_Add_To_OutSTR_with_Sep(Value);
+			UART_WriteString (&OutSTR[0]);
+			goto UART_Execute_Command_END;
+		}
+		//------------------------------
+		// R/W - IV:PREEMPH - DAC pre-emphasis overdrive as fraction of the voltage step, 0 is off
+		COM_Add_To_OutSTR_At_Position("PREEMPH", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == '\0') {
+				// Write data
+				Tmp_FLOAT = StringToFloat(Value);	//Read string to float
+				if (Tmp_FLOAT < 0) IV_Preemph_Gain = 0;
+				else if (Tmp_FLOAT > 10.0) IV_Preemph_Gain = 10.0;
+				else IV_Preemph_Gain = Tmp_FLOAT;
+			}
+			else if (Address[OutSTR_L] == READ_IND_CHAR) COM_Add_QuestMark_To_OutSTR_No_Sep();
+			else goto UART_Execute_Command_ERROR;
+			// Return data read-back
+			FloatToString(Value, IV_Preemph_Gain);	//Write float back to string
+			COM_Add_To_OutSTR_with_Sep(Value);
+			UART_WriteString (&OutSTR[0]);
+			goto UART_Execute_Command_END;
+		}
+		//------------------------------
+		// R/W - IV:FLAGS - return quality flags of each point with IV data, 0 is off
+		COM_Add_To_OutSTR_At_Position("FLAGS", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == '\0') {
+				// Write data
+				Tmp_I32 = atol(Value);
+				if (Tmp_I32 > 0) IV_Point_Flags_On = 1;
+				else IV_Point_Flags_On = 0;
+			}
+			else if (Address[OutSTR_L] == READ_IND_CHAR) COM_Add_QuestMark_To_OutSTR_No_Sep();
+			else goto UART_Execute_Command_ERROR;
+			// Return data read-back
+			itoa (IV_Point_Flags_On, Value, 10);
+			COM_Add_To_OutSTR_with_Sep(Value);
+			UART_WriteString (&OutSTR[0]);
+			goto UART_Execute_Command_END;
+		}
+		//------------------------------
+		// R - IV:ELOST - energy lost during last IV measurement
+		COM_Add_To_OutSTR_At_Position("ELOST", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == READ_IND_CHAR) {
+				COM_Add_QuestMark_To_OutSTR_No_Sep();
+				FloatToString(Value, IV_Sweep_Energy_Lost);
+				COM_Add_To_OutSTR_with_Sep(Value);
+				UART_WriteString (&OutSTR[0]);
+			}
+			else goto UART_Execute_Command_ERROR;
+			goto UART_Execute_Command_END;
+		}
+		//------------------------------
+		// R - IV:HYST - hysteresis index of last forward/reverse IV measurement
+		COM_Add_To_OutSTR_At_Position("HYST", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == READ_IND_CHAR) {
+				COM_Add_QuestMark_To_OutSTR_No_Sep();
+				FloatToString(Value, IV_Hyst_Index);
+				COM_Add_To_OutSTR_with_Sep(Value);
+				UART_WriteString (&OutSTR[0]);
+			}
+			else goto UART_Execute_Command_ERROR;
+			goto UART_Execute_Command_END;
+		}
+		//------------------------------
+		// R - IV:TIME - predicted & actual duration of last IV measurement in ms
+		COM_Add_To_OutSTR_At_Position("TIME", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == READ_IND_CHAR) {
+				COM_Add_QuestMark_To_OutSTR_No_Sep();
+				ltoa (IV_Time_Predicted_ms, Value, 10);
+				COM_Add_To_OutSTR_with_Sep(Value);
+				ltoa (IV_Time_Actual_ms, Value, 10);
+				COM_Add_To_OutSTR_with_Sep(Value);
+				UART_WriteString (&OutSTR[0]);
+			}
+			else goto UART_Execute_Command_ERROR;
+			goto UART_Execute_Command_END;
+		}
+		//------------------------------
+		// R - IV:SCHED:INFO - IV curve counter, lost curves & age of IV curve in buffer
+		COM_Add_To_OutSTR_At_Position("SCHED:INFO", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == READ_IND_CHAR) {
+				COM_Add_QuestMark_To_OutSTR_No_Sep();
+				ltoa (IV_Curve_Count, Value, 10);
+				COM_Add_To_OutSTR_with_Sep(Value);
+				ltoa (IV_Curve_Lost, Value, 10);
+				COM_Add_To_OutSTR_with_Sep(Value);
+				if (IV_Curve_Count > 0) Tmp_FLOAT = (float) (Get_Timer_Main_Ticks() - IV_Curve_Tick) * TIMER_1_TICK_TIME_S;
+				else Tmp_FLOAT = 0;
+				FloatToString(Value, Tmp_FLOAT);
+				COM_Add_To_OutSTR_with_Sep(Value);
+				UART_WriteString (&OutSTR[0]);
+			}
+			else goto UART_Execute_Command_ERROR;
+			goto UART_Execute_Command_END;
+		}
+		//------------------------------
+		// R/W - IV:SCHED:STAG - scheduled IV measurement start delay per com address in seconds
+		COM_Add_To_OutSTR_At_Position("SCHED:STAG", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == '\0') {
+				// Write data
+				Tmp_I32 = atol(Value);	//Read string to long integer
+				// limit boundaries
+				if (Tmp_I32 > 60000) IV_Sched_Stagger_s = 60000;
+				else if (Tmp_I32 <= 0) IV_Sched_Stagger_s = 0;
+				else IV_Sched_Stagger_s = (uint16_t) Tmp_I32;
+				IV_Schedule_Reset();
+			}
+			else if (Address[OutSTR_L] == READ_IND_CHAR) COM_Add_QuestMark_To_OutSTR_No_Sep();
+			else goto UART_Execute_Command_ERROR;
+			// Return data read-back
+			ltoa (IV_Sched_Stagger_s, Value, 10);
+			COM_Add_To_OutSTR_with_Sep(Value);
+			UART_WriteString (&OutSTR[0]);
+			goto UART_Execute_Command_END;
+		}
+		//------------------------------
+		// R/W - IV:SCHED - scheduled IV measurement interval in seconds, 0 is off
+		COM_Add_To_OutSTR_At_Position("SCHED", Last_OutSTR_L);
+		if (COM_Compare_to_OutStr_Offset(Address, Last_OutSTR_L)) {
+			if (Address[OutSTR_L] == '\0') {
+				// Write data
+				Tmp_I32 = atol(Value);	//Read string to long integer
+				// limit boundaries
+				if (Tmp_I32 > 60000) IV_Sched_Interval_s = 60000;
+				else if (Tmp_I32 <= 0) IV_Sched_Interval_s = 0;
+				else IV_Sched_Interval_s = (uint16_t) Tmp_I32;
+				IV_Schedule_Reset();
+			}
+			else if (Address[OutSTR_L] == READ_IND_CHAR) COM_Add_QuestMark_To_OutSTR_No_Sep();
+			else goto UART_Execute_Command_ERROR;
+			// Return data read-back
+			ltoa (IV_Sched_Interval_s, Value, 10);
+			COM_Add_To_OutSTR_with_Sep(Value);
+			UART_WriteString (&OutSTR[0]);
+			goto UART_Execute_Command_END;
+		}
 	}
 	// END: IV Trace Control Commands
 	//##############################
@@ -1147,8 +1730,6 @@ void UART_Transfer_IV() {
 	- once all is transfered the function flags are reset and a termination character is send
 	- function is called in the eternal main loop independent off measurement or control timers
 	*/
-
-	char Value[UART_Value_LENGH+1];
 	
 	// check if IV buffer is full
 	if (is_COM_Status_IV_Buffer_Ready_On) {
@@ -1169,13 +1750,10 @@ void UART_Transfer_IV() {
 	// check if IV buffer was emptied just before
 	if (!is_COM_Status_IV_Buffer_Ready_On) {
 		// buffer empty make new IV data buffer
-		if (Trans_IV_Point < IV_Meas_Points) {
+		if (Trans_IV_Point < IV_Data_Points) {
 			// add some more IV data to buffer
-			FloatToString(Value, PV_IV_Voltage[Trans_IV_Point]);
 			OutSTR_L = 0;
-			COM_Add_To_OutSTR_with_Sep(Value);
-			FloatToString(Value, PV_IV_Current[Trans_IV_Point]);
-			COM_Add_To_OutSTR_with_Sep(Value);
+			COM_Add_IV_Point_To_OutSTR(Trans_IV_Point);
 			Trans_IV_Point++;
 		}
 		else {
@@ -1188,6 +1766,78 @@ void UART_Transfer_IV() {
 	
 }
 
+//-------------------------------------------------------------------------------------------
+// Add IV point to OutSTR
+void COM_Add_IV_Point_To_OutSTR(uint8_t Point) {
+	/* function adds voltage & current of the IV point with separation to OutSTR, with the additional data recorded */
+	
+	char Value[UART_Value_LENGH+1];
+	
+	FloatToString(Value, PV_IV_Voltage[Point]);
+	COM_Add_To_OutSTR_with_Sep(Value);
+	FloatToString(Value, PV_IV_Current[Point]);
+	COM_Add_To_OutSTR_with_Sep(Value);
+	// add current range ID if recorded
+	if (is_IV_Data_Curr_Range) {
+		itoa (PV_IV_Curr_Range[Point], Value, 10);
+		COM_Add_To_OutSTR_with_Sep(Value);
+	}
+	// add number of sets & standard error if recorded
+	if (is_IV_Data_Seq_Stats) {
+		itoa (PV_IV_Nu_Sets[Point], Value, 10);
+		COM_Add_To_OutSTR_with_Sep(Value);
+		FloatToString(Value, (float) PV_IV_Std_Err[Point] * (1.0 / IV_SEQ_SE_SCALE));
+		COM_Add_To_OutSTR_with_Sep(Value);
+	}
+	// add quality flags if recorded
+	if (is_IV_Data_Point_Flags) {
+		itoa (PV_IV_Flags[Point], Value, 10);
+		COM_Add_To_OutSTR_with_Sep(Value);
+	}
+}
+
+//-------------------------------------------------------------------------------------------
+// Stream IV points while measuring
+void UART_Stream_IV(uint8_t Nu_Points_Ready) {
+	/* This Function sends the IV points measured so far during an IV measurement the host requested with IV:STREAM
+	- only sends if the UART transfer buffer is empty, so the measurement is never held up by the transfer
+	- as many of the waiting points as fit are send in one go, they go out during the next point's settling
+	- the points stay in the IV data buffer, Trans_IV_Point is the next point to send
+	*/
+	
+	if (UART_Reply_L != 0) return;
+	if (Trans_IV_Point >= Nu_Points_Ready) return;
+	OutSTR_L = 0;
+	while ((Trans_IV_Point < Nu_Points_Ready) && (OutSTR_L <= (UART_COM_LENGH - UART_STREAM_POINT_MAX_L))) {
+		COM_Add_IV_Point_To_OutSTR(Trans_IV_Point);
+		Trans_IV_Point++;
+	}
+	UART_WriteString (&OutSTR[0]);
+}
+
+//-------------------------------------------------------------------------------------------
+// Finish IV point stream
+void UART_Stream_IV_Finish() {
+	/* This Function sends the remaining IV points & the IV status byte after the IV measurement, or if it was cancelled
+	- the termination character ends the stream & releases the bus to the host
+	*/
+	
+	char Value[UART_Value_LENGH+1];
+	
+	// send remaining points
+	while (Trans_IV_Point < IV_Data_Points) {
+		wdt_reset();
+		UART_Stream_IV(IV_Data_Points);
+	}
+	// status byte & termination
+	CLR__COM_Status_IV_Stream;
+	Trans_IV_Point = 0;
+	OutSTR_L = 0;
+	itoa (IV_Report, Value, 10);
+	COM_Add_To_OutSTR_with_Sep(Value);
+	UART_WriteString (&OutSTR[0]);
+}
+
 //===========================================================================================
 // Data Transfer Functions
 //===========================================================================================
@@ -1223,8 +1873,8 @@ void UART_WriteString (volatile char *STR) {
 		i++;
 	}
 	// set com and string termination
-	// if not IV transfer, then add termination
-	if (!is_COM_Status_IV_Data_Transfer_On) {
+	// if not IV transfer or stream, then add termination
+	if (!is_COM_Status_IV_Data_Transfer_On && !is_COM_Status_IV_Stream_On) {
 		UART_Reply[i] = UART_TERM_CHAR;
 		i++;
 	}
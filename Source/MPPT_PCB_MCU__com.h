@@ -29,6 +29,7 @@
 #define UART_ADR_SEP_CHAR 0x23		// # - character separating address and command
 #define UART_COM_SEP_CHAR 0x3A		// : - character separating command sections
 #define UART_COM_READ_INDICATOR 0x3F	// ? - indicates value read back
+#define UART_STREAM_POINT_MAX_L 60	// maximum length of one IV point with all additional data in the reply
 
 //===========================================================================================
 // VARIABLES and STRUCTURES
@@ -71,6 +72,9 @@ void AddEnd_String_with_Separation(volatile char *ConSTR, volatile char *AddSTR)
 void FloatToString(char *STR, float Value);
 float StringToFloat(char *STR);
 void UART_Transfer_IV();
+void COM_Add_IV_Point_To_OutSTR(uint8_t Point);
+void UART_Stream_IV(uint8_t Nu_Points_Ready);
+void UART_Stream_IV_Finish();
 
 
 //end
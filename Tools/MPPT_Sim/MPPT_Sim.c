@@ -0,0 +1,244 @@
+/*
+	-----------------------------------------
+	MPPT PCB MCU source
+	-----------------------------------------
+	Host side MPPT tracking simulation
+	-----------------------------------------
+	  MPPT Simulation C-Code FILE
+	=========================================
+
+	Compares the tracking efficiency of the simple hill climbing MPPT (load mode 2) and the
+	incremental conductance MPPT (load mode 6) on a simulated single diode PV cell with
+	irradiance steps and ramps, runs on the host PC and not on the MCU
+
+	- the firmware sources are compiled for the host, the AVR I/O layer is replaced by the stubs in stub/
+	- the real PV_Mode__MPPT_Simple_Main() & PV_Mode__MPPT_IncCond_Main() are called once per control cycle,
+	  after the measured values are set as the load control does
+	- the mode init functions search Voc with the hardware, the simulation sets the same start state instead
+	- new IV curve & mini IV sweep branches are not simulated, mini IV sweeps are disabled by default
+	- tracking settings are the EEPROM default values, calibration is range 2 voltage & range 5 current
+	- the measurement of a control cycle is taken at the set-point of the previous cycle with ADC noise
+	- each tracker is run at 5, 20 & 50 counts standard deviation of the ADC noise
+	- efficiency = delivered energy / available energy at the true maximum power point
+*/
+// Build & run in this directory:
+//	gcc -std=gnu99 -O2 -fcommon -Istub -I../../Source -o MPPT_Sim MPPT_Sim.c stub/AVR_Stub.c ../../Source/*.c -lm
+//	./MPPT_Sim
+
+//===========================================================================================
+// INCLUDE Header
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "MPPT_PCB_MCU__Main.h"
+#include "MPPT_PCB_MCU__IO.h"
+#include "MPPT_PCB_MCU__Range.h"
+#include "MPPT_PCB_MCU__EROM.h"
+#include "MPPT_PCB_MCU__LOAD_CTR.h"
+
+#undef main		// renamed by the stub for the firmware main()
+
+//===========================================================================================
+// Definitions and constants
+#define SIM_CYCLE_TIME_S 0.025		// control cycle time, CONTROL_TIMER_MULT 5 @ 5ms
+#define SIM_TIME_S 80.0				// simulated time
+#define SIM_VOLT_RANGE_ID 1			// calibration ranges of the simulated cell
+#define SIM_CURR_RANGE_ID 4
+
+// single diode cell, perovskite like at 1000W/m2
+#define PV_ISC_STC 0.022			// short circuit current [A]
+#define PV_I0 1.0E-14				// diode saturation current [A]
+#define PV_N_VT (1.5 * 0.025852)	// ideality factor * thermal voltage at 300K [V]
+#define PV_RS 3.0					// series resistance [Ohm]
+#define PV_RSH 5000.0				// shunt resistance [Ohm]
+
+//===========================================================================================
+// VARIABLES
+// firmware tracker state, not in the firmware headers
+extern volatile uint16_t LOAD_MPPT_Update_Counter;
+extern volatile float Track_Volt_Old;
+extern volatile float Track_Curr_Old;
+extern volatile float Track_Volt_Step_Size;
+extern volatile float Track_Power_Old;
+extern volatile float PV_Active_Load_Power;
+
+uint32_t Sim_Rand_State;
+float Sim_Noise_CND;		// standard deviation of the ADC noise in counts
+
+//-------------------------------------------------------------------------------------------
+// Gaussian noise, fixed seed so both trackers see the same noise sequence
+float Sim_Noise(){
+	/* function returns a normal distributed random number (Box-Muller), standard deviation 1 */
+	float U1, U2;
+
+	Sim_Rand_State = Sim_Rand_State * 1664525UL + 1013904223UL;
+	U1 = ((float) (Sim_Rand_State >> 8) + 1.0) / 16777217.0;
+	Sim_Rand_State = Sim_Rand_State * 1664525UL + 1013904223UL;
+	U2 = (float) (Sim_Rand_State >> 8) / 16777216.0;
+	return sqrt(-2.0 * log(U1)) * cos(6.2831853 * U2);
+}
+
+//-------------------------------------------------------------------------------------------
+// Irradiance profile
+float Sim_Irradiance(float Time_s){
+	/* function returns the irradiance as fraction of 1000W/m2 at a time
+	- steps & ramps as caused by clouds or light source changes */
+	if (Time_s < 10.0) return 1.0;
+	if (Time_s < 20.0) return 0.3;
+	if (Time_s < 35.0) return 0.3 + 0.6 * (Time_s - 20.0) / 15.0;
+	if (Time_s < 45.0) return 0.6;
+	if (Time_s < 55.0) return 1.0;
+	if (Time_s < 65.0) return 1.0 - 0.8 * (Time_s - 55.0) / 10.0;
+	return 0.5;
+}
+
+//-------------------------------------------------------------------------------------------
+// Single diode model current
+float Sim_PV_Current(float Volt, float Suns){
+	/* function returns the cell current at a voltage, Newton iteration of the implicit single diode equation */
+	float Curr, Diode, F, dF;
+	uint8_t i;
+
+	Curr = PV_ISC_STC * Suns;
+	for (i=0; i < 50; i++) {
+		Diode = PV_I0 * exp((Volt + Curr * PV_RS) / PV_N_VT);
+		F = PV_ISC_STC * Suns - (Diode - PV_I0) - (Volt + Curr * PV_RS) / PV_RSH - Curr;
+		dF = -Diode * PV_RS / PV_N_VT - PV_RS / PV_RSH - 1.0;
+		Curr = Curr - F / dF;
+		if (fabs(F) < 1.0E-12) break;
+	}
+	return Curr;
+}
+
+//-------------------------------------------------------------------------------------------
+// Open circuit voltage
+float Sim_PV_Voc(float Suns){
+	/* function returns Voc by bisection of the current */
+	float Volt_Low, Volt_High, Volt;
+	uint8_t i;
+
+	Volt_Low = 0;
+	Volt_High = 2.0;
+	for (i=0; i < 40; i++) {
+		Volt = 0.5 * (Volt_Low + Volt_High);
+		if (Sim_PV_Current(Volt, Suns) > 0) Volt_Low = Volt;
+		else Volt_High = Volt;
+	}
+	return Volt_Low;
+}
+
+//-------------------------------------------------------------------------------------------
+// Maximum power
+float Sim_PV_Pmax(float Suns){
+	/* function returns the maximum power by golden section search between 0V & Voc */
+	float Volt_A, Volt_B, Volt_C, Volt_D;
+	uint8_t i;
+
+	Volt_A = 0;
+	Volt_B = Sim_PV_Voc(Suns);
+	for (i=0; i < 40; i++) {
+		Volt_C = Volt_B - 0.618034 * (Volt_B - Volt_A);
+		Volt_D = Volt_A + 0.618034 * (Volt_B - Volt_A);
+		if ((Volt_C * Sim_PV_Current(Volt_C, Suns)) > (Volt_D * Sim_PV_Current(Volt_D, Suns))) Volt_B = Volt_D;
+		else Volt_A = Volt_C;
+	}
+	Volt_C = 0.5 * (Volt_A + Volt_B);
+	return Volt_C * Sim_PV_Current(Volt_C, Suns);
+}
+
+//-------------------------------------------------------------------------------------------
+// Measurement
+void Sim_Measure(float Volt, float Suns){
+	/* function sets the measured values as the load control sees them at the start of a control cycle */
+	float Curr;
+
+	Curr = Sim_PV_Current(Volt, Suns);
+	if (Curr < 0) Curr = 0; // load can't drive current into the cell
+	AI_Volt = Volt + AI_Volt_Scale * Sim_Noise_CND * Sim_Noise();
+	AI_Curr_Corr = Curr + AI_Curr_Scale * Sim_Noise_CND * Sim_Noise();
+	PV_Active_Load_Power = AI_Volt * AI_Curr_Corr;
+}
+
+//-------------------------------------------------------------------------------------------
+// Run one tracker over the irradiance profile
+float Sim_Run(uint8_t IncCond, float *Settle_Eff){
+	/* function returns the tracking efficiency over the whole profile
+	- Settle_Eff returns the efficiency of the first second after each irradiance step */
+	float Time_s, Suns, Suns_Old, E_Load, E_Avail, E_Step_Load, E_Step_Avail, Pmax, P_Load;
+	float Step_Time_s;
+	uint32_t Cycle, Nu_Cycles;
+
+	Sim_Rand_State = 12345;
+	// start state of PV_Mode__MPPT_xxx_Init(), Voc is measured at full scale DAC
+	Track_Status = 0;
+	Track_Power_Old = -1000.0;
+	PV_Active_Load_Power = -1000.0;
+	LOAD_MPPT_Update_Counter = LOAD_MPPT_Timer_Update_Delay;
+	LOAD_MPPT_Mini_IV_Counter = LOAD_MPPT_Mini_IV_Interval;
+	Sim_Measure(Sim_PV_Voc(Sim_Irradiance(0)), Sim_Irradiance(0));
+	PV_Volt_DAQ_New = 0.65 * AI_Volt;
+	SET__Track_Status_Dir_Volt_Up;
+	Track_Volt_Step_Size = AI_Volt_Scale * LOAD_MPPT_Max_Step_CND;
+	Track_Volt_Old = AI_Volt;
+	Track_Curr_Old = AI_Curr_Corr;
+
+	E_Load = 0;
+	E_Avail = 0;
+	E_Step_Load = 0;
+	E_Step_Avail = 0;
+	Step_Time_s = -1000.0;
+	Suns_Old = Sim_Irradiance(0);
+	Pmax = Sim_PV_Pmax(Suns_Old);
+	Nu_Cycles = (uint32_t) (SIM_TIME_S / SIM_CYCLE_TIME_S);
+	for (Cycle=0; Cycle < Nu_Cycles; Cycle++) {
+		Time_s = (float) Cycle * SIM_CYCLE_TIME_S;
+		Suns = Sim_Irradiance(Time_s);
+		if (Suns != Suns_Old) {
+			Pmax = Sim_PV_Pmax(Suns);
+			// only steps count as settling events, not ramps
+			if (fabs(Suns - Suns_Old) > 0.1) Step_Time_s = Time_s;
+			Suns_Old = Suns;
+		}
+		// measure at the set-point of the last cycle & update the tracker
+		Sim_Measure(PV_Volt_DAQ_New, Suns);
+		P_Load = PV_Volt_DAQ_New * Sim_PV_Current(PV_Volt_DAQ_New, Suns);
+		if (P_Load < 0) P_Load = 0;
+		E_Load = E_Load + P_Load;
+		E_Avail = E_Avail + Pmax;
+		if ((Time_s - Step_Time_s) < 1.0) {
+			E_Step_Load = E_Step_Load + P_Load;
+			E_Step_Avail = E_Step_Avail + Pmax;
+		}
+		if (IncCond) PV_Mode__MPPT_IncCond_Main();
+		else PV_Mode__MPPT_Simple_Main();
+	}
+	*Settle_Eff = E_Step_Load / E_Step_Avail;
+	return E_Load / E_Avail;
+}
+
+//-------------------------------------------------------------------------------------------
+// MAIN
+int main(){
+	float Eff, Settle_Eff;
+	const float Noise_Levels[3] = {5.0, 20.0, 50.0};
+	uint8_t i;
+
+	// EEPROM default settings & calibration of the simulated ranges
+	EEPROM_LOAD_VAL_CONFIG();
+	EEPROM_LOAD_VOLTAGE_RANGE(SIM_VOLT_RANGE_ID);
+	EEPROM_LOAD_CURRENT_RANGE(SIM_CURR_RANGE_ID);
+
+	printf("Simulated cell: Isc %.1fmA, Voc %.3fV, Pmax %.2fmW at 1000W/m2\n",
+		PV_ISC_STC * 1000.0, Sim_PV_Voc(1.0), Sim_PV_Pmax(1.0) * 1000.0);
+	printf("%.0fs profile, %.0fms control cycle\n\n", SIM_TIME_S, SIM_CYCLE_TIME_S * 1000.0);
+	printf("Noise  Mode                       Efficiency   First 1s after steps\n");
+	for (i=0; i < 3; i++) {
+		Sim_Noise_CND = Noise_Levels[i];
+		Eff = Sim_Run(0, &Settle_Eff);
+		printf("%5.0f  2 - MPPT simple (P&O)      %6.2f%%      %6.2f%%\n", Sim_Noise_CND, Eff * 100.0, Settle_Eff * 100.0);
+		Eff = Sim_Run(1, &Settle_Eff);
+		printf("%5.0f  6 - MPPT incr. conductance %6.2f%%      %6.2f%%\n", Sim_Noise_CND, Eff * 100.0, Settle_Eff * 100.0);
+	}
+	return 0;
+}
@@ -0,0 +1,84 @@
+/*
+	-----------------------------------------
+	Host stub of the AVR I/O layer for the MPPT simulation
+	-----------------------------------------
+	- registers are variables, SPI & TWI transfers complete at once
+	- EEPROM access reads & writes the EEMEM variables in RAM
+	- delays & the watchdog do nothing
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "avr/io.h"
+#include "avr/eeprom.h"
+#include "avr/interrupt.h"
+#include "avr/wdt.h"
+#include "util/delay.h"
+
+//===========================================================================================
+// REGISTERS
+volatile uint8_t DDRA, DDRB, DDRC, DDRD;
+volatile uint8_t PORTA, PORTB, PORTC, PORTD;
+volatile uint8_t PINA, PINC, PIND;
+volatile uint8_t SPCR, SPDR;
+volatile uint8_t SPSR = _BV(SPIF);	// transfer always complete
+volatile uint8_t TWBR, TWDR, TWSR;
+volatile uint8_t TWCR = _BV(TWINT);	// transfer always complete
+volatile uint8_t UCSR0A = _BV(UDRE0), UCSR0B, UCSR0C, UBRR0H, UBRR0L, UDR0;
+volatile uint8_t TCCR1A, TCCR1B, TIMSK1, TIFR1;
+volatile uint16_t TCNT1, OCR1B;
+volatile uint16_t OCR1A = 1249;
+volatile uint8_t SREG, MCUSR;
+
+//===========================================================================================
+// EEPROM
+uint8_t eeprom_read_byte(const uint8_t *Adr) { return *Adr; }
+uint16_t eeprom_read_word(const uint16_t *Adr) { return *Adr; }
+uint32_t eeprom_read_dword(const uint32_t *Adr) { return *Adr; }
+float eeprom_read_float(const float *Adr) { return *Adr; }
+void eeprom_read_block(void *Dst, const void *Adr, unsigned int Size) { memcpy(Dst, Adr, Size); }
+void eeprom_write_byte(uint8_t *Adr, uint8_t Value) { *Adr = Value; }
+void eeprom_write_word(uint16_t *Adr, uint16_t Value) { *Adr = Value; }
+void eeprom_write_dword(uint32_t *Adr, uint32_t Value) { *Adr = Value; }
+void eeprom_write_float(float *Adr, float Value) { *Adr = Value; }
+void eeprom_write_block(const void *Src, void *Adr, unsigned int Size) { memcpy(Adr, Src, Size); }
+void eeprom_update_byte(uint8_t *Adr, uint8_t Value) { *Adr = Value; }
+void eeprom_update_word(uint16_t *Adr, uint16_t Value) { *Adr = Value; }
+void eeprom_update_dword(uint32_t *Adr, uint32_t Value) { *Adr = Value; }
+void eeprom_update_float(float *Adr, float Value) { *Adr = Value; }
+void eeprom_update_block(const void *Src, void *Adr, unsigned int Size) { memcpy(Adr, Src, Size); }
+
+//===========================================================================================
+// INTERRUPTS, WATCHDOG & DELAYS
+void sei(void) {}
+void cli(void) {}
+void wdt_reset(void) {}
+void wdt_enable(int Timeout) { (void) Timeout; }
+void wdt_disable(void) {}
+void _delay_ms(double Time_ms) { (void) Time_ms; }
+void _delay_us(double Time_us) { (void) Time_us; }
+
+//===========================================================================================
+// NUMBER CONVERSIONS of avr-libc
+char *ltoa(long Value, char *STR, int Radix) {
+	if (Radix == 16) sprintf(STR, "%lx", Value);
+	else sprintf(STR, "%ld", Value);
+	return STR;
+}
+char *ultoa(unsigned long Value, char *STR, int Radix) {
+	if (Radix == 16) sprintf(STR, "%lx", Value);
+	else sprintf(STR, "%lu", Value);
+	return STR;
+}
+char *itoa(int Value, char *STR, int Radix) { return ltoa(Value, STR, Radix); }
+char *utoa(unsigned int Value, char *STR, int Radix) { return ultoa(Value, STR, Radix); }
+char *dtostrf(double Value, signed char Width, unsigned char Prec, char *STR) {
+	sprintf(STR, "%*.*f", Width, Prec, Value);
+	return STR;
+}
+char *dtostre(double Value, char *STR, unsigned char Prec, unsigned char Flags) {
+	(void) Flags;
+	sprintf(STR, "%.*e", Prec, Value);
+	return STR;
+}
@@ -0,0 +1,2 @@
+/* file name as included by the firmware, the Windows tool chain ignores the case */
+#include "MPPT_PCB_MCU__Main.h"
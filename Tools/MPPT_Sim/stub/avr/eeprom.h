@@ -0,0 +1,25 @@
+/* Host stub of <avr/eeprom.h>, EEMEM variables are plain variables holding their default values */
+#ifndef AVR_STUB_EEPROM_H_
+#define AVR_STUB_EEPROM_H_
+
+#include <stdint.h>
+
+#define EEMEM
+
+uint8_t eeprom_read_byte(const uint8_t *Adr);
+uint16_t eeprom_read_word(const uint16_t *Adr);
+uint32_t eeprom_read_dword(const uint32_t *Adr);
+float eeprom_read_float(const float *Adr);
+void eeprom_read_block(void *Dst, const void *Adr, unsigned int Size);
+void eeprom_write_byte(uint8_t *Adr, uint8_t Value);
+void eeprom_write_word(uint16_t *Adr, uint16_t Value);
+void eeprom_write_dword(uint32_t *Adr, uint32_t Value);
+void eeprom_write_float(float *Adr, float Value);
+void eeprom_write_block(const void *Src, void *Adr, unsigned int Size);
+void eeprom_update_byte(uint8_t *Adr, uint8_t Value);
+void eeprom_update_word(uint16_t *Adr, uint16_t Value);
+void eeprom_update_dword(uint32_t *Adr, uint32_t Value);
+void eeprom_update_float(float *Adr, float Value);
+void eeprom_update_block(const void *Src, void *Adr, unsigned int Size);
+
+#endif /* AVR_STUB_EEPROM_H_ */
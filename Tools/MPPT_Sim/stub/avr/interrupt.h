@@ -0,0 +1,10 @@
+/* Host stub of <avr/interrupt.h>, interrupt routines become plain functions */
+#ifndef AVR_STUB_INTERRUPT_H_
+#define AVR_STUB_INTERRUPT_H_
+
+#define ISR(Vector) void Vector(void)
+
+void sei(void);
+void cli(void);
+
+#endif /* AVR_STUB_INTERRUPT_H_ */
@@ -0,0 +1,72 @@
+/* 
+	-----------------------------------------
+	Host stub of <avr/io.h> for the MPPT simulation
+	-----------------------------------------
+	- registers are plain variables, defined in AVR_Stub.c
+	- bit numbers as on the ATmega1284
+	- the firmware main() is renamed, the simulation has its own
+	- <math.h> is included, avr-gcc knows the math functions as builtins
+*/
+
+#ifndef AVR_STUB_IO_H_
+#define AVR_STUB_IO_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+
+#define main MCU_Main
+
+#define _BV(b) (1 << (b))
+
+// ports
+extern volatile uint8_t DDRA, DDRB, DDRC, DDRD;
+extern volatile uint8_t PORTA, PORTB, PORTC, PORTD;
+extern volatile uint8_t PINA, PINC, PIND;
+// SPI
+extern volatile uint8_t SPCR, SPSR, SPDR;
+#define SPR0 0
+#define SPR1 1
+#define CPHA 2
+#define CPOL 3
+#define MSTR 4
+#define SPE 6
+#define SPI2X 0
+#define SPIF 7
+// TWI
+extern volatile uint8_t TWBR, TWCR, TWDR, TWSR;
+#define TWEN 2
+#define TWSTO 4
+#define TWSTA 5
+#define TWEA 6
+#define TWINT 7
+#define TWPS0 0
+#define TWPS1 1
+// USART 0
+extern volatile uint8_t UCSR0A, UCSR0B, UCSR0C, UBRR0H, UBRR0L, UDR0;
+#define UDRE0 5
+#define RXC0 7
+#define TXEN0 3
+#define RXEN0 4
+#define TXCIE0 6
+#define RXCIE0 7
+#define UCSZ00 1
+#define USBS0 3
+// timer 1
+extern volatile uint8_t TCCR1A, TCCR1B, TIMSK1, TIFR1;
+extern volatile uint16_t TCNT1, OCR1A, OCR1B;
+#define OCIE1A 1
+#define OCF1A 1
+// system
+extern volatile uint8_t SREG, MCUSR;
+#define WDRF 3
+
+// avr-libc number conversions of <stdlib.h>
+char *itoa(int Value, char *STR, int Radix);
+char *utoa(unsigned int Value, char *STR, int Radix);
+char *ltoa(long Value, char *STR, int Radix);
+char *ultoa(unsigned long Value, char *STR, int Radix);
+char *dtostrf(double Value, signed char Width, unsigned char Prec, char *STR);
+char *dtostre(double Value, char *STR, unsigned char Prec, unsigned char Flags);
+
+#endif /* AVR_STUB_IO_H_ */
@@ -0,0 +1,13 @@
+/* Host stub of <avr/pgmspace.h>, program memory is normal memory */
+#ifndef AVR_STUB_PGMSPACE_H_
+#define AVR_STUB_PGMSPACE_H_
+
+#include <stdint.h>
+
+#define PROGMEM
+#define pgm_read_byte(Adr) (*(const uint8_t *) (Adr))
+#define pgm_read_word(Adr) (*(const uint16_t *) (Adr))
+#define pgm_read_dword(Adr) (*(const uint32_t *) (Adr))
+#define pgm_read_float(Adr) (*(const float *) (Adr))
+
+#endif /* AVR_STUB_PGMSPACE_H_ */
@@ -0,0 +1,13 @@
+/* Host stub of <avr/wdt.h> */
+#ifndef AVR_STUB_WDT_H_
+#define AVR_STUB_WDT_H_
+
+#define WDTO_500MS 5
+#define WDTO_1S 6
+#define WDTO_2S 7
+
+void wdt_reset(void);
+void wdt_enable(int Timeout);
+void wdt_disable(void);
+
+#endif /* AVR_STUB_WDT_H_ */
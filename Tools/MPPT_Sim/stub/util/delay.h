@@ -0,0 +1,8 @@
+/* Host stub of <util/delay.h>, delays return at once */
+#ifndef AVR_STUB_DELAY_H_
+#define AVR_STUB_DELAY_H_
+
+void _delay_ms(double Time_ms);
+void _delay_us(double Time_us);
+
+#endif /* AVR_STUB_DELAY_H_ */